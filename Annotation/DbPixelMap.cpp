@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    DbPixelMap.cpp
+
+  ==============================================================================
+*/
+
+#include "../punch.h"
+
+namespace punch {
+
+    void DbPixelMap::setRange(float minAmp, float maxAmp)
+    {
+        _minAmp = minAmp;
+        _maxAmp = maxAmp;
+        rebuild();
+    }
+
+    void DbPixelMap::setPixels(int minY, int maxY)
+    {
+        _minY = minY;
+        _maxY = maxY;
+        rebuild();
+    }
+
+    float DbPixelMap::getY(double db) const
+    {
+        if (db <= _minAmp) return (float)_minY;
+        if (db >= _maxAmp) return (float)_maxY;
+        if (_maxAmp != _minAmp) return (float)_minY + (((float)db - _minAmp) * ((float)(_maxY - _minY) / (_maxAmp - _minAmp)));
+        return (float)_minY;
+    }
+
+    double DbPixelMap::getDb(float y) const
+    {
+        // inverse of getY, clamped to the range
+        if (_maxY == _minY) return _minAmp;
+        double proportion = juce::jlimit(0.0, 1.0, (double)(y - (float)_minY) / (double)(_maxY - _minY));
+        return _minAmp + proportion * (double)(_maxAmp - _minAmp);
+    }
+
+    int DbPixelMap::getYFromTable(double db) const
+    {
+        if (_tableSize == 0) return _minY;
+        int i = juce::roundToInt(((float)db - _minAmp) * _stepsPerDb);
+        return _table[juce::jlimit(0, _tableSize - 1, i)];
+    }
+
+    void DbPixelMap::rebuild()
+    {
+        // A tall meter over a narrow range needs finer steps than 0.1 dB, or the bar
+        // would move several pixels at a time.
+        float range = juce::jmax(0.0f, _maxAmp - _minAmp);
+        int n = juce::jmax(1, juce::roundToInt(range * _minStepsPerDb) + 1, std::abs(_maxY - _minY) + 1);
+        _stepsPerDb = range > 0.0f ? (float)(n - 1) / range : _minStepsPerDb;
+        if (n > _tableCapacity)
+        {
+            _table.malloc((size_t)n);
+            _tableCapacity = n;
+        }
+        _tableSize = n;
+        for (int i = 0; i < n; i++)
+        {
+            _table[i] = juce::roundToInt(getY(_minAmp + (double)i / _stepsPerDb));
+        }
+    }
+}
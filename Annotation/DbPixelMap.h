@@ -0,0 +1,48 @@
+/*
+  ==============================================================================
+
+    DbPixelMap.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "../punch.h"
+
+namespace punch {
+
+    /** Linear dB to y mapping shared by the annotation scale and continuous meters.
+
+        minY is the pixel for minAmp (the bottom), maxY the pixel for maxAmp (the top).
+        getYFromTable() reads a table rebuilt on every range or size change, so meters
+        can map a level without any arithmetic beyond an index. The table has at least
+        one entry per pixel and at most 0.1 dB between entries.
+    */
+    class DbPixelMap
+    {
+    public:
+        DbPixelMap() {};
+        void setRange(float minAmp, float maxAmp);
+        void setPixels(int minY, int maxY);
+        float getY(double db) const;
+        int getYFromTable(double db) const;
+        double getDb(float y) const;
+        float getMinAmp() const { return _minAmp; }
+        float getMaxAmp() const { return _maxAmp; }
+        int getMinY() const { return _minY; }
+        int getMaxY() const { return _maxY; }
+
+    private:
+        void rebuild();
+        static constexpr float _minStepsPerDb = 10.0f;
+        float _stepsPerDb = _minStepsPerDb;
+        float _minAmp = -60.0f;
+        float _maxAmp = 0.0f;
+        int _minY = 0;
+        int _maxY = 0;
+        juce::HeapBlock<int> _table;   // only grows, range and size changes reuse it
+        int _tableSize = 0;
+        int _tableCapacity = 0;
+    };
+}
@@ -26,113 +26,109 @@ namespace punch {
         _minY = 0; // init in resized
         _maxY = 0; // init in resized
         _showSignalClipped = showSignalClipped;
+        _map.setRange(minAmp, maxAmp);
     };
 
 
     void dbAnnoComponent::paint(juce::Graphics& g)
+    {
+        // The scale only changes with size or range, so it is drawn once into an
+        // image at the display scale and every other paint is a single blit.
+        float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        int iw = juce::jmax(1, juce::roundToInt((float)getWidth() * scale));
+        int ih = juce::jmax(1, juce::roundToInt((float)getHeight() * scale));
+        bool resize = scale != _scaleImageScale || _scaleImage.getWidth() != iw || _scaleImage.getHeight() != ih;
+        if (resize || _scaleImageDirty)
+        {
+            if (resize) _scaleImage = juce::Image(juce::Image::ARGB, iw, ih, true);
+            else _scaleImage.clear(_scaleImage.getBounds());
+            juce::Graphics ig(_scaleImage);
+            ig.addTransform(juce::AffineTransform::scale(scale));
+            drawScale(ig);
+            _scaleImageScale = scale;
+            _scaleImageDirty = false;
+        }
+        g.drawImageTransformed(_scaleImage, juce::AffineTransform::scale(1.0f / scale));
+    }
+
+    void dbAnnoComponent::drawScale(juce::Graphics& g)
     {
 
         // g.setColour(Colours::red);
         // g.drawRect(0,0,getBounds().getWidth(),getBounds().getHeight(), 1.0);
 
-        int width = getBounds().getWidth();
+        drawScale(g, _map, getLocalBounds(), _incAmp, _style, _showSignalClipped);
+    }
+
+    void dbAnnoComponent::drawScale(juce::Graphics& g, const DbPixelMap& map, juce::Rectangle<int> area, float incAmpf,
+        juce::Justification style, bool showSignalClipped)
+    {
+        int x = area.getX();
+        int width = area.getWidth();
         int textWidth = width;
         int textHeight = 9;
+        float maxY = (float)map.getMaxY();
+        float minY = (float)map.getMinY();
 
         g.setColour(juce::Colours::white);        
         g.setFont(juce::Font("Lucinda Sans Typewriter", "Regular", 11.0f));
-        if (_showSignalClipped) g.drawText("clip", 0, (int)(_maxY - (textHeight / 2.0f) - 12.0f), textWidth, textHeight, juce::Justification::centredLeft);
-        //g.drawRect(0, (int)(_maxY - (textHeight / 2.0f) - 12.0f), textWidth, textHeight);
-
-        juce::StringPairArray dbAnnoPos = get_db_pairs(_minAmp, _maxAmp, _incAmp);
+        if (showSignalClipped) g.drawText("clip", x, (int)(maxY - (textHeight / 2.0f) - 12.0f), textWidth, textHeight, juce::Justification::centredLeft);
 
         auto font = g.getCurrentFont();
-        for (auto& key : dbAnnoPos.getAllKeys())
+        int incAmp = juce::jmax(1, (int)incAmpf);
+        for (int v = (int)map.getMinAmp(); v <= (int)map.getMaxAmp(); v++)
         {
-            if (dbAnnoPos[key] != "")
+            float y = map.getY(v);
+            if (v % incAmp == 0)
             {
                 g.setColour(juce::Colours::white);
-                auto annoText = dbAnnoPos[key];
-                if (_style == juce::Justification::left)
+                juce::String annoText = v > 0 ? "+" + juce::String(v) : juce::String(v);
+                if (style == juce::Justification::left)
                 {
                     annoText = annoText.substring(1, annoText.length()) + annoText.substring(0, 1);
                 }
-                g.drawText(annoText, 0, (int)(key.getFloatValue() - (textHeight / 2.0f)), textWidth, textHeight, _style);
+                g.drawText(annoText, x, (int)(y - (textHeight / 2.0f)), textWidth, textHeight, style);
                 int strWidth = font.getStringWidth(annoText);
                 float tickHeight = 1.0f;
-                if (annoText == "0") tickHeight = 2.5f;
-                if (_style == juce::Justification::left)
+                if (v == 0) tickHeight = 2.5f;
+                if (style == juce::Justification::left)
                 {
-                    g.drawRect((float)strWidth, key.getFloatValue() - (tickHeight/2.0f), (float)width - strWidth, tickHeight, 1.0f);
+                    g.drawRect((float)(x + strWidth), y - (tickHeight/2.0f), (float)width - strWidth, tickHeight, 1.0f);
                 }
                 else // must be right
                 {
-                    g.drawRect(0.0, key.getFloatValue() - (tickHeight / 2.0f), (float)width - strWidth, tickHeight, 1.0f);
+                    g.drawRect((float)x, y - (tickHeight / 2.0f), (float)width - strWidth, tickHeight, 1.0f);
                 }
             }
             else
             {
                 g.setColour(juce::Colours::grey);
-                g.drawRect(0.0, key.getFloatValue(), (float)width, 0.5f, 0.5f);
+                g.drawRect((float)x, y, (float)width, 0.5f, 0.5f);
             }
         }
-        if (_showSignalClipped) g.drawText("signal", 0, (int)(_minY + (textHeight / 2.0f) ), textWidth, textHeight, juce::Justification::centredLeft);
-        //g.drawRect(0, (int)(_minY + (textHeight / 2.0f)), textWidth, textHeight);
-
+        if (showSignalClipped) g.drawText("signal", x, (int)(minY + (textHeight / 2.0f) ), textWidth, textHeight, juce::Justification::centredLeft);
     }
 
     void dbAnnoComponent::resized()
     {
         _maxY = _marginTop;
         _minY = getBounds().getHeight() - _marginBottom;
+        _map.setPixels(_minY, _maxY);
+        _scaleImageDirty = true;
     }
 
-
-    void dbAnnoComponent::addPair(juce::StringPairArray& pairs, juce::String format, float v, float pixel)
-    {
-
-        char buffer[50];
-        juce::String annoString = "";
-        if (format != "")
-        {
-            sprintf(buffer, format.getCharPointer(), (float)v);
-            annoString = buffer;
-        }
-        sprintf(buffer, "%f", pixel);
-        juce::String pixelString = buffer;
-        pairs.set(pixelString, annoString);
-    };
-
-    float dbAnnoComponent::getYFromDb(double db)
+    void dbAnnoComponent::setRange(float minAmp, float maxAmp, float incAmp)
     {
-        if (db <= _minAmp) return (float)_minY;
-        if (db >= _maxAmp) return (float)_maxY;
-        if (_maxAmp != _minAmp) return (float)_minY + (((float)db - _minAmp) * ((float)(_maxY - _minY) / (_maxAmp - _minAmp)));
-        return (float)_minY;
+        _minAmp = minAmp;
+        _maxAmp = maxAmp;
+        _incAmp = incAmp;
+        _map.setRange(minAmp, maxAmp);
+        _scaleImageDirty = true;
+        repaint();
     }
 
-    juce::StringPairArray dbAnnoComponent::get_db_pairs(float minAmp, float maxAmp, float incAmp)
+    float dbAnnoComponent::getYFromDb(double db)
     {
-        juce::StringPairArray pairs;
-
-        for (int v = (int)minAmp; v <= (int)maxAmp; v++)
-        {
-            if (v % (int)incAmp == 0)
-            {
-                if (v == 0) {
-                    addPair(pairs, "%1.0f", (float)v, getYFromDb(v));
-                }
-                else
-                {
-                    addPair(pairs, "%+2.0f", (float)v, getYFromDb(v));
-                }
-            }
-            else
-            {
-                addPair(pairs, "", (float)v, getYFromDb(v));
-            }
-        }
-
-        return pairs;
+        return _map.getY(db);
     }
 }
\ No newline at end of file
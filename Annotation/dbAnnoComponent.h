@@ -24,6 +24,11 @@ namespace punch {
             juce::Justification style, bool showSignalClipped = false);
         void paint(juce::Graphics& g) override;
         void resized() override;
+        void setRange(float minAmp, float maxAmp, float incAmp);
+
+        /** Draws a scale for any mapping, so composites can share one DbPixelMap. */
+        static void drawScale(juce::Graphics& g, const DbPixelMap& map, juce::Rectangle<int> area, float incAmp,
+            juce::Justification style, bool showSignalClipped);
 
     private:
 
@@ -38,10 +43,13 @@ namespace punch {
         juce::Justification _style;
         bool _showSignalClipped;
 
-        float getYFromDb(double db);
-        void addPair(juce::StringPairArray& pairs, juce::String format, float v, float pixel);
+        DbPixelMap _map;
+        juce::Image _scaleImage;  // rendered scale, redrawn in place on a range change
+        float _scaleImageScale = 0.0f;
+        bool _scaleImageDirty = true;
 
-        juce::StringPairArray get_db_pairs(float minAmp, float maxAmp, float incAmp);
+        float getYFromDb(double db);
+        void drawScale(juce::Graphics& g);
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(dbAnnoComponent)
     };
 }
\ No newline at end of file
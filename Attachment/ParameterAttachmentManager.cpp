@@ -0,0 +1,160 @@
+/*
+  ==============================================================================
+
+    ParameterAttachmentManager.cpp
+
+  ==============================================================================
+*/
+
+#include "../punch.h"
+
+namespace punch {
+
+    ParameterAttachmentManager::ParameterAttachmentManager(juce::UndoManager* undoManager) :
+        _undoManager(undoManager)
+    {
+    }
+
+    ParameterAttachmentManager::~ParameterAttachmentManager()
+    {
+        clear();
+    }
+
+    void ParameterAttachmentManager::addSlider(juce::RangedAudioParameter& parameter, juce::Slider& slider)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+        auto* param = &parameter;
+        slider.valueFromTextFunction = [param](const juce::String& text) { return (double)param->convertFrom0to1(param->getValueForText(text)); };
+        slider.textFromValueFunction = [param](double value) { return param->getText(param->convertTo0to1((float)value), 0); };
+        slider.setDoubleClickReturnValue(true, param->convertFrom0to1(param->getDefaultValue()));
+        slider.setNormalisableRange(makeSliderRange(parameter));
+
+        _bindings.push_back({ &slider, param, nullptr, -1.0f, -1.0f, nullptr });
+        show(_bindings.back(), param->getValue(), 0.0f);
+        slider.addListener(this);
+    }
+
+    void ParameterAttachmentManager::addTwoValueSlider(juce::RangedAudioParameter& minParameter, juce::RangedAudioParameter& maxParameter, juce::Slider& slider)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+        jassert(slider.isTwoValue());
+        slider.setNormalisableRange(makeSliderRange(minParameter));
+
+        _bindings.push_back({ &slider, &minParameter, &maxParameter, -1.0f, -1.0f, nullptr });
+        show(_bindings.back(), minParameter.getValue(), maxParameter.getValue());
+        slider.addListener(this);
+    }
+
+    void ParameterAttachmentManager::remove(juce::Slider& slider)
+    {
+        if (auto* b = find(&slider))
+            if (b->gesture != nullptr) b->gesture->endChangeGesture();
+        slider.removeListener(this);
+        _bindings.erase(std::remove_if(_bindings.begin(), _bindings.end(), [&](const Binding& b) { return b.slider == &slider; }), _bindings.end());
+    }
+
+    void ParameterAttachmentManager::clear()
+    {
+        for (auto& b : _bindings)
+        {
+            if (b.gesture != nullptr) b.gesture->endChangeGesture();
+            b.slider->removeListener(this);
+        }
+        _bindings.clear();
+    }
+
+    void ParameterAttachmentManager::refresh()
+    {
+        // getValue() only reads the parameter's atomic, so this is one cheap loop.
+        for (auto& b : _bindings)
+        {
+            float value = b.parameter->getValue();
+            float maxValue = b.maxParameter != nullptr ? b.maxParameter->getValue() : 0.0f;
+            if (value != b.lastValue || (b.maxParameter != nullptr && maxValue != b.lastMaxValue)) show(b, value, maxValue);
+        }
+    }
+
+    void ParameterAttachmentManager::show(Binding& b, float value, float maxValue)
+    {
+        b.lastValue = value;
+        b.lastMaxValue = maxValue;
+
+        const juce::ScopedValueSetter<bool> svs(_ignoreCallbacks, true);
+        if (b.maxParameter == nullptr)
+        {
+            b.slider->setValue(b.parameter->convertFrom0to1(value), juce::sendNotificationSync);
+        }
+        else
+        {
+            // both thumbs in one update, one repaint
+            b.slider->setMinAndMaxValues(b.parameter->convertFrom0to1(value), b.maxParameter->convertFrom0to1(maxValue), juce::sendNotificationSync);
+        }
+    }
+
+    ParameterAttachmentManager::Binding* ParameterAttachmentManager::find(juce::Slider* slider)
+    {
+        // only on user edits, so a linear search is fine
+        for (auto& b : _bindings)
+            if (b.slider == slider) return &b;
+        return nullptr;
+    }
+
+    juce::RangedAudioParameter* ParameterAttachmentManager::getDragged(Binding& b)
+    {
+        if (b.maxParameter == nullptr) return b.parameter;
+        return b.slider->getThumbBeingDragged() == 2 ? b.maxParameter : b.parameter;
+    }
+
+    void ParameterAttachmentManager::sliderValueChanged(juce::Slider* slider)
+    {
+        if (_ignoreCallbacks) return;
+        auto* b = find(slider);
+        if (b == nullptr) return;
+
+        // Record what was sent as shown, so the next poll does not echo it back.
+        // Wheel, keyboard, text box and double click edits have no drag, so each is
+        // sent as a complete gesture of its own.
+        auto send = [this, b](juce::RangedAudioParameter* p, double value, float& last)
+        {
+            float normalised = p->convertTo0to1((float)value);
+            if (normalised == last) return;
+            last = normalised;
+            bool inGesture = b->gesture == p;
+            if (!inGesture)
+            {
+                if (_undoManager != nullptr) _undoManager->beginNewTransaction();
+                p->beginChangeGesture();
+            }
+            p->setValueNotifyingHost(normalised);
+            if (!inGesture) p->endChangeGesture();
+        };
+
+        if (b->maxParameter == nullptr)
+        {
+            send(b->parameter, slider->getValue(), b->lastValue);
+        }
+        else
+        {
+            send(b->parameter, slider->getMinValue(), b->lastValue);
+            send(b->maxParameter, slider->getMaxValue(), b->lastMaxValue);
+        }
+    }
+
+    void ParameterAttachmentManager::sliderDragStarted(juce::Slider* slider)
+    {
+        if (auto* b = find(slider))
+        {
+            if (_undoManager != nullptr) _undoManager->beginNewTransaction();
+            b->gesture = getDragged(*b);
+            b->gesture->beginChangeGesture();
+        }
+    }
+
+    void ParameterAttachmentManager::sliderDragEnded(juce::Slider* slider)
+    {
+        auto* b = find(slider);
+        if (b == nullptr || b->gesture == nullptr) return;
+        b->gesture->endChangeGesture();
+        b->gesture = nullptr;
+    }
+}
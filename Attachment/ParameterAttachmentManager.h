@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    ParameterAttachmentManager.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "../punch.h"
+
+namespace punch {
+
+    /** Binds many sliders, range sliders and faders to parameters without a
+        listener or async updater per parameter.
+
+        Once per frame the manager reads every bound parameter's current value in
+        one pass over a flat array and updates only the controls whose value moved.
+        Control edits go straight to the parameter with proper change gestures.
+        Everything runs on the message thread.
+    */
+    class ParameterAttachmentManager : private RefreshScheduler::Client,
+        private juce::Slider::Listener
+    {
+    public:
+        ParameterAttachmentManager(juce::UndoManager* undoManager = nullptr);
+        ~ParameterAttachmentManager() override;
+
+        /** Any juce::Slider, FaderSlider and SmoothSlider included. */
+        void addSlider(juce::RangedAudioParameter& parameter, juce::Slider& slider);
+
+        /** A TwoValueVertical or TwoValueHorizontal slider driven by two parameters. */
+        void addTwoValueSlider(juce::RangedAudioParameter& minParameter, juce::RangedAudioParameter& maxParameter, juce::Slider& slider);
+
+        void remove(juce::Slider& slider);
+        void clear();
+        int size() { return (int)_bindings.size(); }
+
+    private:
+        struct Binding
+        {
+            juce::Slider* slider;
+            juce::RangedAudioParameter* parameter;
+            juce::RangedAudioParameter* maxParameter;   // nullptr unless two-value
+            float lastValue;                            // normalised, as last shown
+            float lastMaxValue;
+            juce::RangedAudioParameter* gesture;        // parameter of the drag in progress
+        };
+
+        void refresh() override;
+        void show(Binding& b, float value, float maxValue);
+        Binding* find(juce::Slider* slider);
+        juce::RangedAudioParameter* getDragged(Binding& b);
+        void sliderValueChanged(juce::Slider* slider) override;
+        void sliderDragStarted(juce::Slider* slider) override;
+        void sliderDragEnded(juce::Slider* slider) override;
+
+        std::vector<Binding> _bindings;
+        juce::UndoManager* _undoManager;
+        bool _ignoreCallbacks = false;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParameterAttachmentManager);
+    };
+}
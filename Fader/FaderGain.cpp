@@ -0,0 +1,129 @@
+/*
+  ==============================================================================
+
+    FaderGain.cpp
+
+  ==============================================================================
+*/
+
+#include "../punch.h"
+
+namespace punch {
+
+    FaderGain::FaderGain(juce::RangedAudioParameter& parameter, float minusInfinityDb, int tableSize) :
+        _parameter(parameter),
+        _minusInfinityDb(minusInfinityDb),
+        _tableSize(juce::jmax(2, tableSize))
+    {
+        buildTable();
+        reset();
+    }
+
+    void FaderGain::buildTable()
+    {
+        // One extra entry so interpolation at 1.0 needs no bounds check.
+        _table.allocate((size_t)_tableSize + 1, false);
+        for (int i = 0; i <= _tableSize; i++)
+        {
+            float db = _parameter.convertFrom0to1((float)i / (float)_tableSize);
+            _table[i] = juce::Decibels::decibelsToGain(db, _minusInfinityDb);
+        }
+    }
+
+    float FaderGain::getGainForValue(float normalisedValue) const
+    {
+        float pos = juce::jlimit(0.0f, 1.0f, normalisedValue) * (float)_tableSize;
+        int i = juce::jmin((int)pos, _tableSize - 1);
+        float frac = pos - (float)i;
+        return _table[i] + frac * (_table[i + 1] - _table[i]);
+    }
+
+    void FaderGain::prepare(double sampleRate, int maxBlockSize, double smoothingSeconds)
+    {
+        _maxBlockSize = juce::jmax(1, maxBlockSize);
+        _ramp.allocate((size_t)_maxBlockSize, false);
+        _rampDouble.allocate((size_t)_maxBlockSize, false);
+        _smoothingSamples = juce::jmax(0, juce::roundToInt(sampleRate * smoothingSeconds));
+        reset();
+    }
+
+    void FaderGain::reset()
+    {
+        // jump straight to the parameter's gain, no ramp
+        _lastValue = _parameter.getValue();
+        _current = _target = getGainForValue(_lastValue);
+        _step = 0.0f;
+        _remaining = 0;
+    }
+
+    void FaderGain::updateTarget()
+    {
+        float value = _parameter.getValue();
+        if (value == _lastValue) return;
+        _lastValue = value;
+        _target = getGainForValue(value);
+
+        // a new target restarts the ramp from wherever the gain is now
+        if (_smoothingSamples == 0)
+        {
+            _current = _target;
+            _remaining = 0;
+            return;
+        }
+        _remaining = _smoothingSamples;
+        _step = (_target - _current) / (float)_smoothingSamples;
+    }
+
+    template <typename Type>
+    void FaderGain::apply(juce::AudioBuffer<Type>& buffer, Type* ramp)
+    {
+        if (_maxBlockSize == 0)
+        {
+            jassertfalse; // call prepare() first
+            return;
+        }
+        updateTarget();
+
+        int nChannels = buffer.getNumChannels();
+        int done = 0;
+        int nSamples = buffer.getNumSamples();
+        while (done < nSamples)
+        {
+            int n = juce::jmin(nSamples - done, _maxBlockSize);
+            int ramped = juce::jmin(n, _remaining);
+            if (ramped > 0)
+            {
+                // the ramp is computed once and multiplied into every channel
+                for (int i = 0; i < ramped; i++)
+                {
+                    _current += _step;
+                    ramp[i] = (Type)_current;
+                }
+                _remaining -= ramped;
+                if (_remaining == 0) _current = _target;
+                for (int c = 0; c < nChannels; c++)
+                    juce::FloatVectorOperations::multiply(buffer.getWritePointer(c, done), ramp, ramped);
+            }
+
+            int steady = n - ramped;
+            if (steady > 0)
+            {
+                if (_current == 0.0f) for (int c = 0; c < nChannels; c++) buffer.clear(c, done + ramped, steady);
+                else if (_current != 1.0f)
+                    for (int c = 0; c < nChannels; c++)
+                        juce::FloatVectorOperations::multiply(buffer.getWritePointer(c, done + ramped), (Type)_current, steady);
+            }
+            done += n;
+        }
+    }
+
+    void FaderGain::process(juce::AudioBuffer<float>& buffer)
+    {
+        apply(buffer, _ramp.get());
+    }
+
+    void FaderGain::process(juce::AudioBuffer<double>& buffer)
+    {
+        apply(buffer, _rampDouble.get());
+    }
+}
@@ -0,0 +1,57 @@
+/*
+  ==============================================================================
+
+    FaderGain.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "../punch.h"
+
+namespace punch {
+
+    /** Real-time gain stage for the parameter a FaderSlider controls.
+
+        The parameter's value is taken to be in dB. Its whole taper, normalised
+        0..1 to linear gain, is tabulated once, so a block costs one table lookup.
+        Changes ramp linearly over the smoothing time, sample-accurate and continued
+        across blocks. The gain is applied in place to every channel with
+        FloatVectorOperations. Nothing allocates after prepare().
+    */
+    class FaderGain
+    {
+    public:
+        FaderGain(juce::RangedAudioParameter& parameter, float minusInfinityDb = -100.0f, int tableSize = 1024);
+        void prepare(double sampleRate, int maxBlockSize, double smoothingSeconds = 0.02);
+        void reset();
+        void process(juce::AudioBuffer<float>& buffer);
+        void process(juce::AudioBuffer<double>& buffer);
+        float getGainForValue(float normalisedValue) const;
+        float getCurrentGain() const { return _current; }
+        bool isSmoothing() const { return _remaining > 0; }
+
+    private:
+        void buildTable();
+        void updateTarget();
+        template <typename Type>
+        void apply(juce::AudioBuffer<Type>& buffer, Type* ramp);
+
+        juce::RangedAudioParameter& _parameter;
+        float _minusInfinityDb;
+        int _tableSize;
+        juce::HeapBlock<float> _table;
+        juce::HeapBlock<float> _ramp;
+        juce::HeapBlock<double> _rampDouble;
+        int _maxBlockSize = 0;
+        int _smoothingSamples = 0;
+        float _lastValue = -1.0f;
+        float _current = 1.0f;
+        float _target = 1.0f;
+        float _step = 0.0f;
+        int _remaining = 0;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FaderGain);
+    };
+}
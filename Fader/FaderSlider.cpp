@@ -27,6 +27,39 @@ FaderSliderLookAndFeel::~FaderSliderLookAndFeel()
 void FaderSliderLookAndFeel::drawLinearSliderBackground(juce::Graphics& g, int x, int y, int width, int height,
     float, float, float,
     const Slider::SliderStyle, Slider& slider)
+{
+    // The track only changes with size, colour, enabled state or display scale, so it
+    // is rendered once into an image and automation repaints just blit it.
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const juce::Colour trackColour(slider.findColour(Slider::trackColourId));
+    const juce::Rectangle<int> area(x, y, width, height);
+
+    if (!_trackImage.isValid() || area != _trackArea || trackColour != _trackColour
+        || slider.isEnabled() != _trackEnabled || slider.isHorizontal() != _trackHorizontal || scale != _trackScale)
+    {
+        _trackArea = area;
+        _trackColour = trackColour;
+        _trackEnabled = slider.isEnabled();
+        _trackHorizontal = slider.isHorizontal();
+        _trackScale = scale;
+
+        // the rounded track overhangs the slider area by half a radius at each end
+        const float sliderRadius = (float)getSliderThumbRadius(slider) * 0.5f;
+        _trackBounds = area.toFloat().expanded(sliderRadius * 0.5f + 1.0f).getSmallestIntegerContainer();
+        _trackImage = juce::Image(juce::Image::ARGB,
+            juce::jmax(1, juce::roundToInt((float)_trackBounds.getWidth() * scale)),
+            juce::jmax(1, juce::roundToInt((float)_trackBounds.getHeight() * scale)), true);
+
+        juce::Graphics tg(_trackImage);
+        tg.addTransform(juce::AffineTransform::translation((float)-_trackBounds.getX(), (float)-_trackBounds.getY()).scaled(scale));
+        drawTrack(tg, x, y, width, height, slider);
+    }
+
+    g.drawImageTransformed(_trackImage, juce::AffineTransform::scale(1.0f / scale)
+        .translated((float)_trackBounds.getX(), (float)_trackBounds.getY()));
+}
+
+void FaderSliderLookAndFeel::drawTrack(juce::Graphics& g, int x, int y, int width, int height, Slider& slider)
 {
     //g.setColour(Colours::red);
     //g.drawRect(x, y, width, height, 1.0);
@@ -70,12 +103,7 @@ void FaderSliderLookAndFeel::drawLinearSlider(juce::Graphics& g, int x, int y, i
 
     if (thumbImage.isValid())
     {
-        int imgWidth = thumbImage.getWidth();
-        int imgHeight = thumbImage.getHeight();
-
-        const float centerX = width * 0.5f;
-
-        g.drawImage(thumbImage, (int)centerX - (imgWidth / 2), (int)sliderPos - (imgHeight / 2), imgWidth, imgHeight, 0, 0, imgWidth, imgHeight);
+        drawThumb(g, width * 0.5f, sliderPos);
     }
     else
     {
@@ -87,6 +115,18 @@ void FaderSliderLookAndFeel::drawLinearSlider(juce::Graphics& g, int x, int y, i
         g.drawFittedText(juce::String("No Image"), text_bounds.getSmallestIntegerContainer(), juce::Justification::horizontallyCentred | juce::Justification::centred, 1);
     }
 }
+void FaderSliderLookAndFeel::drawThumb(juce::Graphics& g, float centreX, float sliderPos)
+{
+    if (!thumbImage.isValid()) return;
+    auto bounds = getThumbBounds(centreX, sliderPos);
+    g.drawImage(thumbImage, bounds.getX(), bounds.getY(), bounds.getWidth(), bounds.getHeight(), 0, 0, bounds.getWidth(), bounds.getHeight());
+}
+juce::Rectangle<int> FaderSliderLookAndFeel::getThumbBounds(float centreX, float sliderPos)
+{
+    int imgWidth = thumbImage.getWidth();
+    int imgHeight = thumbImage.getHeight();
+    return { (int)centreX - (imgWidth / 2), (int)sliderPos - (imgHeight / 2), imgWidth, imgHeight };
+}
 int FaderSliderLookAndFeel::getSliderThumbRadius(juce::Slider&)
 {
     return 21;
@@ -139,246 +179,15 @@ namespace FaderBinaryData
 static const unsigned char temp_binary_data_3[] =
 "\x89PNG\r\n"
 "\x1a\n"
-"\0\0\0\rIHDR\0\0\0\x14\0\0\0-\x08\x06\0\0\0\xae\xfcKh\0\0\0\tpHYs\0\0\x0e\xc4\0\0\x0e\xc4\x01\x95+\x0e\x1b\0\0""B\x01iTXtXML:com.adobe.xmp\0\0\0\0\0<?xpacket begin=\"\xef\xbb\xbf\" id=\"W5M0MpCehiHzreSzNTczkc9d\"?>\n"
-"<x:xmpmeta xmlns:x=\"adobe:ns:meta/\" x:xmptk=\"Adobe XMP Core 5.6-c067 79.157747, 2015/03/30-23:40:42        \">\n"
-"   <rdf:RDF xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#\">\n"
-"      <rdf:Description rdf:about=\"\"\n"
-"            xmlns:xmp=\"http://ns.adobe.com/xap/1.0/\"\n"
-"            xmlns:dc=\"http://purl.org/dc/elements/1.1/\"\n"
-"            xmlns:photoshop=\"http://ns.adobe.com/photoshop/1.0/\"\n"
-"            xmlns:xmpMM=\"http://ns.adobe.com/xap/1.0/mm/\"\n"
-"            xmlns:stEvt=\"http://ns.adobe.com/xap/1.0/sType/ResourceEvent#\"\n"
-"            xmlns:stRef=\"http://ns.adobe.com/xap/1.0/sType/ResourceRef#\"\n"
-"            xmlns:tiff=\"http://ns.adobe.com/tiff/1.0/\"\n"
-"            xmlns:exif=\"http://ns.adobe.com/exif/1.0/\">\n"
-"         <xmp:CreatorTool>Adobe Photoshop CC 2015 (Windows)</xmp:CreatorTool>\n"
-"         <xmp:CreateDate>2022-11-08T11:54:26-06:00</xmp:CreateDate>\n"
-"         <xmp:ModifyDate>2022-12-08T06:55:19-06:00</xmp:ModifyDate>\n"
-"         <xmp:MetadataDate>2022-12-08T06:55:19-06:00</xmp:MetadataDate>\n"
-"         <dc:format>image/png</dc:format>\n"
-"         <photoshop:ColorMode>3</photoshop:ColorMode>\n"
-"         <xmpMM:InstanceID>xmp.iid:204fcf86-09c2-134a-ba64-778f35156c33</xmpMM:InstanceID>\n"
-"         <xmpMM:DocumentID>adobe:docid:photoshop:7742492e-76f7-11ed-b307-a76dc0d0d01e</xmpMM:DocumentID>\n"
-"         <xmpMM:OriginalDocumentID>xmp.did:2db6ffb6-ef62-e041-addf-fbc3db31823c</xmpMM:OriginalDocumentID>\n"
-"         <xmpMM:History>\n"
-"            <rdf:Seq>\n"
-"               <rdf:li rdf:parseType=\"Resource\">\n"
-"                  <stEvt:action>created</stEvt:action>\n"
-"                  <stEvt:instanceID>xmp.iid:2db6ffb6-ef62-e041-addf-fbc3db31823c</stEvt:instanceID>\n"
-"                  <stEvt:when>2022-11-08T11:54:26-06:00</stEvt:when>\n"
-"                  <stEvt:softwareAgent>Adobe Photoshop CC 2015 (Windows)</stEvt:softwareAgent>\n"
-"               </rdf:li>\n"
-"               <rdf:li rdf:parseType=\"Resource\">\n"
-"                  <stEvt:action>converted</stEvt:action>\n"
-"                  <stEvt:parameters>from image/png to application/vnd.adobe.photoshop</stEvt:parameters>\n"
-"               </rdf:li>\n"
-"               <rdf:li rdf:parseType=\"Resource\">\n"
-"                  <stEvt:action>saved</stEvt:action>\n"
-"                  <stEvt:instanceID>xmp.iid:b03f6496-2d86-1a40-bb79-afd29c990618</stEvt:instanceID>\n"
-"                  <stEvt:when>2022-12-06T14:22:14-06:00</stEvt:when>\n"
-"                  <stEvt:softwareAgent>Adobe Photoshop CC 2015 (Windows)</stEvt:softwareAgent>\n"
-"                  <stEvt:changed>/</stEvt:changed>\n"
-"               </rdf:li>\n"
-"               <rdf:li rdf:parseType=\"Resource\">\n"
-"                  <stEvt:action>saved</stEvt:action>\n"
-"                  <stEvt:instanceID>xmp.iid:a60c33bc-5307-494c-a83a-d88d608a1964</stEvt:instanceID>\n"
-"                  <stEvt:when>2022-12-08T06:55:19-06:00</stEvt:when>\n"
-"                  <stEvt:softwareAgent>Adobe Photoshop CC 2015 (Windows)</stEvt:softwareAgent>\n"
-"                  <stEvt:changed>/</stEvt:changed>\n"
-"               </rdf:li>\n"
-"               <rdf:li rdf:parseType=\"Resource\">\n"
-"                  <stEvt:action>converted</stEvt:action>\n"
-"                  <stEvt:parameters>from application/vnd.adobe.photoshop to image/png</stEvt:parameters>\n"
-"               </rdf:li>\n"
-"               <rdf:li rdf:parseType=\"Resource\">\n"
-"                  <stEvt:action>derived</stEvt:action>\n"
-"                  <stEvt:parameters>converted from application/vnd.adobe.photoshop to image/png</stEvt:parameters>\n"
-"               </rdf:li>\n"
-"               <rdf:li rdf:parseType=\"Resource\">\n"
-"                  <stEvt:action>saved</stEvt:action>\n"
-"                  <stEvt:instanceID>xmp.iid:204fcf86-09c2-134a-ba64-778f35156c33</stEvt:instanceID>\n"
-"                  <stEvt:when>2022-12-08T06:55:19-06:00</stEvt:when>\n"
-"                  <stEvt:softwareAgent>Adobe Photoshop CC 2015 (Windows)</stEvt:softwareAgent>\n"
-"                  <stEvt:changed>/</stEvt:changed>\n"
-"               </rdf:li>\n"
-"            </rdf:Seq>\n"
-"         </xmpMM:History>\n"
-"         <xmpMM:DerivedFrom rdf:parseType=\"Resource\">\n"
-"            <stRef:instanceID>xmp.iid:a60c33bc-5307-494c-a83a-d88d608a1964</stRef:instanceID>\n"
-"            <stRef:documentID>adobe:docid:photoshop:99f7dc21-75a3-11ed-90be-9fe2fbe79816</stRef:documentID>\n"
-"            <stRef:originalDocumentID>xmp.did:2db6ffb6-ef62-e041-addf-fbc3db31823c</stRef:originalDocumentID>\n"
-"         </xmpMM:DerivedFrom>\n"
-"         <tiff:Orientation>1</tiff:Orientation>\n"
-"         <tiff:XResolution>960000/10000</tiff:XResolution>\n"
-"         <tiff:YResolution>960000/10000</tiff:YResolution>\n"
-"         <tiff:ResolutionUnit>2</tiff:ResolutionUnit>\n"
-"         <exif:ColorSpace>65535</exif:ColorSpace>\n"
-"         <exif:PixelXDimension>20</exif:PixelXDimension>\n"
-"         <exif:PixelYDimension>45</exif:PixelYDimension>\n"
-"      </rdf:Description>\n"
-"   </rdf:RDF>\n"
-"</x:xmpmeta>\n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                                                                                                    \n"
-"                            \n"
-"<?xpacket end=\"w\"?>\x07\xf4\n"
-"\xee\0\0\0 cHRM\0\0z%\0\0\x80\x83\0\0\xf9\xff\0\0\x80\xe9\0\0u0\0\0\xea`\0\0:\x98\0\0\x17o\x92_\xc5""F\0\0\x0eMIDATx\x01\0=\x0e\xc2\xf1\x01\xff\xff\xff\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x04\0\0\0\0`jj\xfe\xfa\xfa\xfa\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfa\xfa\xfa\0\x06\x06\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfb\xf7\xf7\0\xce\xc7\xc7\0\xdd\xde\xde\x02\x04"
-"\0\0\0\0\x12\x14\x14\0\xfc\xfc\xfc\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfc\xfc\xfc\0\x04\x04\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xf1\xec\xec\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\x17\x19\x19\0\xff\xfd\xfd\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfe\xfe\xfe\0\x02\x02\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfe\xfa\xfa\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\xc0\xbc\xbc\0\xfb\xf9\xf9\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfc\xfc\xfc\0\x04\x04\x04\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x05\x01\x01\0\x01\x01\x01\0\0\0\0\0\x04\0\0\0\0\xda\xd6\xd6\0\xf9\xf8\xf8\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfa\xfa\xfa\0\x06\x06\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x15"
-"\x13\x13\0\xfe\xff\xff\0\x01\x01\x01M\x04\0\0\0\0\x02\x02\x02\0\x01\x02\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\x01\x01\0\x01\x02\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\x01\x01\0\0\xff\xff\0\0\0\0\0\x04\0\0\0\0\x02"
-"\x01\x01\0\x02\x03\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\x03\x03\0\x02\x03\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\x01\x01\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\0\x02\x02\0\x01\x01\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\x01\x01\x01\0\x01\x01\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\x01\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\x03\x02\x02\0\x03\x02\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\x01\x01\0\x03\x02\x02\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\x01\x01\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\x02\x03\x03\0\x03\x03\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\x03\x03\0\x03\x03\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\x01\x01\0\x01\x01\x01"
-"\0\0\0\0\0\x04\0\0\0\0\x02\x01\x01\0\x01\x01\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\x01\x01\0\x01\x01\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\x01\x01\0\xfe\xfe\xfe\0\0\0\0\0\x04\0\0\0\0\x02\x03\x03\0\x03\x03\x03\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\x03\x03\0\x03\x03\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\x02\x02\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\x03\x02\x02\0\x02\x02\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\x02"
-"\x02\0\x02\x02\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\x01\x01\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\x02\x03\x03\0\x03\x04\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\x03\x03\0\x03\x04\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\x02\x02\x02\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\xef\xee\xee\0\x0f\x11\x11\0\xfe\xfc\xfc\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\x01\x01\0\x02\x01\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\x01\0\x02\x03\x03\0\xf2\xf2\xf2\0\x03\x02\x02\0"
-"\0\0\0\0\x04\0\0\0\0\xe4\xe3\xe3\0\x02\x02\x02\0\x14\x15\x15\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\x02\0\t\x08\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfb\xfb\xfb\0\xf1\xf0\xf0\0\xf2\xf0\xf0\0\x0b\x07\x07\0\0\0\0\0\x04\0\0\0\0\t\x04\x04\0\xeb"
-"\xe5\xe5\0\xeb\xe5\xe5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xf0\xf0\xf0\0\x10\x10\x10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x0e\x0e\x0e\0\x0c\x0c\x0c\0\0\0\0\0\x04\0\0\0\0\xf7\xfc\xfc\0""7::\0\x14\x17\x17\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\xfa\xfa\xfa\0\x06\x06\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xec\xe9\xe9\0\xd9\xd5\xd5\0\xf4\xf4\xf4\0\0\0\0\0\x04\0\0\0\0-//\0\x11\x10\x10\0\xfb\xf7\xf7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\xfb\xf7\xf7\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x11\x10\x10\0\"##\0\xe6\xe1\xe1\0\0\0\0\0\x04\0\0\0\0\r\x0e\x0e\0\xec\xeb\xeb\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xf5\xf6\xf6\0\x0b\n"
-"\n"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\x01\0\x04\x05\x05\0\x03\x03\x03\0\0\0\0\0\x04\0\0\0\0\x02\x03\x03\0\x03\x04\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x04\x03\x03\0\x03\x04\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\x06\x06\x06\0\xfe\xfe\xfe\0\0\0\0\0\x04\0\0\0\0\x06\x06\x06\0\0\xff\xff\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x05\xfd\xfd\0\x05\x06\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x05\x05\x05\0\0\xff\xff\0\0\0\0\0\x04\0\0\0\0\t"
-"\t\t\0\x02\x02\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\0\0\0\x08\t\t\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x05\x03\x03\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\t\n"
-"\n"
-"\0\x02\x03\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\x02\x02\0\x07\x08\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x04\x01\x01\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\x08\n"
-"\n"
-"\0\x03\x03\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x05\x05\x05\0\x05\x05\x05\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\x01\0\x02\x01\x01\0\0\0\0\0\x04\0\0\0\0\x0b\x0b\x0b\0\xfd\x08\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\xfc\xfc\xfc\0\x04\x04\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfe\xfd\xfd\0\x01\x02\x02\0\0\0\0\0\x04\0\0\0\0\x0e\x0e\x0e\0\xfb\xfc\xfc\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfd\xfd\xfd\0\x03\x03\x03\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfe\xfc\xfc\0\xfd\xfe\xfe\0\0\0\0\0\x04\0\0\0\0\r\x10\x10\0\xff\xfe\xfe\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfe\xff\xff\0\x02\x01\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xf9\xf8\xf8\0"
-"\0\0\0\0\0\0\0\0\x04\0\0\0\0\xe8\xe5\xe5\0\xfc\xfc\xfc\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfc\xfc\xfc\0\x04\x04\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xfd\xfd\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\xc6\xc0\xc0\0\xf9\xf8\xf8\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xf3\xf3\xf3\0\r\r\r\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\t\t\t\0\x02\x01\x01\0\0\0\0\0\x04\0\0\0\0\xfd\xfd\xfd\0\xfe\xfd\xfd\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfd\xfd\xfd\0"
-"\xfe\xfd\xfd\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfd\xfc\xfc\0\x02\x03\x03\0\0\0\0\0\x04\0\0\0\0\xfb\xfb\xfb\0\xfb\xfc\xfc\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfb\xfa\xfa\0\xfb\xfc\xfc\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\x03\xfc\xfc\0\xfe\xfe\xfe\0\0\0\0\0\x04\0\0\0\0\xfc\xfa\xfa\0\xfb\xfa\xfa\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xf9\xf9\xf9\0\xfb\xfa\xfa\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x04\x02\x02\0\0\xff\xff\0\0\0\0\0\x04"
-"\0\0\0\0\xfa\xfb\xfb\0\xfa\xfa\xfa\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfa\xf9\xf9\0\xfa\xfa\xfa\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x04\x03\x03\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\xfb\xfb\xfb\0\xfb\xfa\xfa\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfa\xfa\xfa\0\xfb\xfa\xfa\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfa\x05\x05\0\x01\0\0\0\0\0\0\0\x04\0\0\0\0\xfc\xfa\xfa\0\x03\x03\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\x03\x03\0\x03\x03\x03"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfa\xf8\xf8\0\n"
-"\x06\x06\0\0\0\0\0\0\xff\xff\xff\0\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe\0\0\0\xfe%$$\xfe\0\0\0M\x01\xff\xff\xff\0\0\0\0\0\x01\x01"
-"\x01M\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\xff\xff\xb4\xa8\x1d[W1;\xd3\0\0\0\0IEND\xae""B`\x82";
+"\0\0\0\rIHDR\0\0\0\x14\0\0\0-\x08\x06\0\0\0\xae\xfcKh\0\0\x02\x89IDATx\xda\xedW\xc1n\xda@\x10\x1d\xafm\xc0\x18SH@(\xd7&=V9V\xca?\xe4\x1fz\xce""7\xe6\xc0\xa9\xb9\xe5\x96H\xad\xd4HQ\x9a\xaa\x11(%@C\xc0\xd8\xee\xcc\xc6\x98\xb5\xeb\x9dM!\x87\x1e\xba\xd2\x82"
+"\xe4\xb7\xf3<ovfvm%I\x02\xaf""9\x04\xbc\xf2\xf8\xf7\t\x1d\xfa\xf9xr\x12/\x16\x0b\xed\"\xc2*\x95\x8a\x16\x0fg38?;\x83\xafWWB\x12\xeet:\xb0\\.\xb5\x06\x84""9\x8e\xa3\xc5\x1f\x86\xc3\xbc\x87\xbd\xbd=H\xa2Hk\x10\xc7""1\x08\xa1\x8fN\xac\xa8\x93\x84\xfd\xd3"
+"S\x08\xe7\xf3\x8d=t-\x0b,\x9c\x19\xe1\x97\xcbK\x98?=m\x1c\xc3\xee\xee.\xc4\x98\xcfHz,\tI\x8e\xc5H\xa2\xb7\x9bpH\x0b\xe4\x99\x10\x1f\x08\xdb\xd6\xe7\x16""b\x1c\xbe\x92\x9b\x11\x02y\xa8<,\xf5\x90\xc1\xa1Hh#\xa1\xcdH\"\x05&<GHrl\x83""d\x0eO\x8a\xbb,\x0c"
+"\x92L\x92\xc9\x9er\xf5\xc5\x1e\xda\x06\\\xcd\x80,\x86\\%\x08\x13^\x1a""C\xa6\x12\x8cx\xd1\xc3\x9f\xf7\xf7\xf0\xa6\xdd\x86X\xd3 d\x9e\x96\xc5""0\xcd\xdf\xf1x\x9c""e\x81$\xfcvs#\xdf\xd2\xe9vu.\x80W\xab\xfd\xd9\xb6\xc2\x10\x1e""F#\x18\xe3\xf4\xab\xd5""5"
+"\xa1\x87r\x06\xb7\xb7r\x96\x8d\x11\x1a\xb4Z-\xad\xe4""f\xb3\t\x8d""FcM8C\xa9\x1f\x8e\x8e\xa0\xd3\xeb\xfdus\x18\xde\xdd\xc1\xe7\x8b\x0b\x98N\xa7k\xc2\xf7\x87\x87\xd0""F\x0f\xa8\xf3\x96\xa6""E\xda\x95\xcb\x06\xd9\xbd\xdd\xdf\x87\xef\xd7\xd7k\xc2\0]\x1e"
+"\x0e\x06ZI\xbf\x1e\x1f\xc1\xaf\xd7\xb5u\xec\xb8n\x96\xa7/J\x1b\xc7\x80S8r\x95\"\xe3\xc3\x1c\xf8.\x1e\x0f.\xd3`]\xf4""0\xd7\x0f=\xcf""c+\x81\x96\xd6p\x8d\x96P)\xcbgB\x8c\x0f\xdb`\xf1""e\xd5\x92<\xccH\x8a\xa5WCB\xae\xf8I\x92\x94\xc5""4X\xa1\xb6/\xdf\xf7"
+"!b<0\x9dz1\xc6\xd8RK\x8f""2=d\x0e\xfa\x08\r8\x05\xd4\x03\"u\x97\x03L\xce$}Pj\x80;(\x98\x06\xab\x1e\xc1\x92\xf0\x07\xd6\xf0""6W\x11\xf5\xd6!W}\xea\xf7\xd9\x83~2\x99@\x10\x04Z\\\xa6\x9d\xba)\x14\xa3\x98\xb9\xdb\x18qT \xd4\xd2\xa3\xbe\xc6mJ\x88\xdd\x86\xc3"
+"m\xc4r\xa5\xb7$\x03\xe6~8\xc7\x8b\x14\x87;\x94""2j\xe9-\xd0""C\xf6\xc2\x89\x84\x1c\xee\x14KOJ6\xdc`Y\x1c\xab\xc8R\tI\xf2""6\xe7\xf2\x02""3\xa4\xbe\xea""F\xe9wJ\xbc\xed|wp@\xff\xc7\xd6\xea\xc3\x87.\x8b\xff?|6\x1a\xbf\x01\xb4\xa8\x1d[}\x0b""9\x11\0\0\0"
+"\0IEND\xae""B`\x82";
 
 const char* faderalphanonflat_png = (const char*)temp_binary_data_3;
 
@@ -394,7 +203,7 @@ const char* getNamedResource(const char* resourceNameUTF8, int& numBytes)
 
     switch (hash)
     {
-    case 0x96e0bf88:  numBytes = 20692; return faderalphanonflat_png;
+    case 0x96e0bf88:  numBytes = 706; return faderalphanonflat_png;
     default: break;
     }
 
@@ -26,10 +26,20 @@ public:
         const juce::Slider::SliderStyle, juce::Slider&) override;
     void drawLabel(juce::Graphics& g, juce::Label& label);
     int getSliderThumbRadius(juce::Slider& slider) override;
+    void drawTrack(juce::Graphics& g, int x, int y, int width, int height, juce::Slider& slider);
+    void drawThumb(juce::Graphics& g, float centreX, float sliderPos);
+    juce::Rectangle<int> getThumbBounds(float centreX, float sliderPos);
 
 
 private:
     juce::Image thumbImage;
+    juce::Image _trackImage;            // cached track, keyed by the fields below
+    juce::Rectangle<int> _trackArea;
+    juce::Rectangle<int> _trackBounds;
+    juce::Colour _trackColour;
+    bool _trackEnabled = true;
+    bool _trackHorizontal = false;
+    float _trackScale = 0.0f;
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FaderSliderLookAndFeel)
 };
 
@@ -47,7 +57,7 @@ private:
 namespace FaderBinaryData
 {
     extern const char* faderalphanonflat_png;
-    const int            faderalphanonflat_pngSize = 20692;
+    const int            faderalphanonflat_pngSize = 706;
 
     // Number of elements in the namedResourceList and originalFileNames arrays.
     const int namedResourceListSize = 1;
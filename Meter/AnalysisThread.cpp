@@ -0,0 +1,179 @@
+/*
+  ==============================================================================
+
+    AnalysisThread.cpp
+
+  ==============================================================================
+*/
+#include "../punch.h"
+
+namespace punch {
+
+    AnalysisThread::AnalysisThread() : juce::Thread("punch analysis")
+    {
+    }
+
+    AnalysisThread::~AnalysisThread()
+    {
+        stop();
+    }
+
+    void AnalysisThread::init(int size, int nChannels, double sampleRate)
+    {
+        jassert(!isThreadRunning()); // resize only while stopped
+        _nChannels = nChannels;
+        _sampleRate = sampleRate;
+        _ring.setSize(nChannels, size);
+        _fifo.setTotalSize(size);
+        _fifo.reset();
+        resetCounters();
+    }
+
+    void AnalysisThread::addStage(Stage stage)
+    {
+        const juce::ScopedLock lock(_stageLock);
+        _stages.add(std::move(stage));
+    }
+
+    void AnalysisThread::clearStages()
+    {
+        const juce::ScopedLock lock(_stageLock);
+        _stages.clear();
+    }
+
+    void AnalysisThread::setInterval(int milliseconds)
+    {
+        _intervalMs = juce::jmax(1, milliseconds);
+    }
+
+    void AnalysisThread::setMaxBatchSamples(int samples)
+    {
+        _maxBatchSamples = samples; // 0 hands over everything available
+    }
+
+    void AnalysisThread::start()
+    {
+        startThread();
+    }
+
+    void AnalysisThread::stop()
+    {
+        stopThread(1000);
+    }
+
+    void AnalysisThread::push(const juce::AudioBuffer<float>& amps)
+    {
+        int nsamps = amps.getNumSamples();
+        int nchannels = juce::jmin(amps.getNumChannels(), _nChannels);
+        if (_fifo.getFreeSpace() < nsamps)
+        {
+            // analysis is behind, drop the block rather than block the audio thread
+            _overflows++;
+            return;
+        }
+
+        int start1, size1, start2, size2;
+        _fifo.prepareToWrite(nsamps, start1, size1, start2, size2);
+        for (int c = 0; c < nchannels; c++)
+        {
+            auto readptr = amps.getReadPointer(c);
+            if (size1 > 0) _ring.copyFrom(c, start1, readptr, size1);
+            if (size2 > 0) _ring.copyFrom(c, start2, readptr + size1, size2);
+        }
+        for (int c = nchannels; c < _nChannels; c++)
+        {
+            // a block with fewer channels leaves silence, not stale audio
+            if (size1 > 0) _ring.clear(c, start1, size1);
+            if (size2 > 0) _ring.clear(c, start2, size2);
+        }
+        _fifo.finishedWrite(size1 + size2);
+
+        int lag = _fifo.getNumReady();
+        if (lag > _maxLag.load()) _maxLag = lag;
+    }
+
+    void AnalysisThread::push(const juce::AudioBuffer<double>& amps)
+    {
+        int nsamps = amps.getNumSamples();
+        int nchannels = juce::jmin(amps.getNumChannels(), _nChannels);
+        if (_fifo.getFreeSpace() < nsamps)
+        {
+            _overflows++;
+            return;
+        }
+
+        int start1, size1, start2, size2;
+        _fifo.prepareToWrite(nsamps, start1, size1, start2, size2);
+        for (int c = 0; c < nchannels; c++)
+        {
+            auto readptr = amps.getReadPointer(c);
+            auto writeptr = _ring.getWritePointer(c);
+            for (int i = 0; i < size1; i++) writeptr[start1 + i] = (float)readptr[i];
+            for (int i = 0; i < size2; i++) writeptr[start2 + i] = (float)readptr[size1 + i];
+        }
+        for (int c = nchannels; c < _nChannels; c++)
+        {
+            if (size1 > 0) _ring.clear(c, start1, size1);
+            if (size2 > 0) _ring.clear(c, start2, size2);
+        }
+        _fifo.finishedWrite(size1 + size2);
+
+        int lag = _fifo.getNumReady();
+        if (lag > _maxLag.load()) _maxLag = lag;
+    }
+
+    int AnalysisThread::getLagSamples()
+    {
+        return _fifo.getNumReady();
+    }
+
+    double AnalysisThread::getLagSeconds()
+    {
+        return (double)getLagSamples() / _sampleRate;
+    }
+
+    int AnalysisThread::getMaxLagSamples()
+    {
+        return _maxLag.load();
+    }
+
+    int AnalysisThread::getOverflows()
+    {
+        return _overflows.load();
+    }
+
+    void AnalysisThread::resetCounters()
+    {
+        _overflows = 0;
+        _maxLag = 0;
+    }
+
+    void AnalysisThread::process(int start, int nSamples)
+    {
+        // Refers to the ring directly, the stages see the samples without another copy.
+        juce::AudioBuffer<float> block(_ring.getArrayOfWritePointers(), _nChannels, start, nSamples);
+        const juce::ScopedLock lock(_stageLock);
+        for (auto& stage : _stages) stage(block);
+    }
+
+    void AnalysisThread::run()
+    {
+        while (!threadShouldExit())
+        {
+            int ready = _fifo.getNumReady();
+            int maxBatch = _maxBatchSamples.load();
+            if (maxBatch > 0) ready = juce::jmin(ready, maxBatch);
+
+            if (ready > 0)
+            {
+                int start1, size1, start2, size2;
+                _fifo.prepareToRead(ready, start1, size1, start2, size2);
+                if (size1 > 0) process(start1, size1);
+                if (size2 > 0) process(start2, size2);
+                _fifo.finishedRead(size1 + size2);
+            }
+
+            if (_fifo.getNumReady() == 0) wait(_intervalMs.load());
+        }
+    }
+}
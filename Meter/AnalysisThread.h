@@ -0,0 +1,59 @@
+/*
+  ==============================================================================
+
+    AnalysisThread.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include "../punch.h"
+
+namespace punch {
+
+    /** Moves capture work off the audio callback.
+
+        The audio thread only copies each block into a lock-free ring with push().
+        A dedicated thread wakes every few milliseconds, takes everything that has
+        arrived and hands it to the registered stages in as few calls as possible.
+    */
+    class AnalysisThread : private juce::Thread
+    {
+    public:
+        using Stage = std::function<void(juce::AudioBuffer<float>&)>;
+
+        AnalysisThread();
+        ~AnalysisThread() override;
+        void init(int size, int nChannels, double sampleRate);
+        void addStage(Stage stage);
+        void clearStages();
+        void setInterval(int milliseconds);
+        void setMaxBatchSamples(int samples);
+        void start();
+        void stop();
+        void push(const juce::AudioBuffer<float>& amps);
+        void push(const juce::AudioBuffer<double>& amps);
+        int getLagSamples();
+        double getLagSeconds();
+        int getMaxLagSamples();
+        int getOverflows();
+        void resetCounters();
+
+    private:
+        void run() override;
+        void process(int start, int nSamples);
+
+        juce::AbstractFifo _fifo { 1 };
+        juce::AudioBuffer<float> _ring;
+        juce::CriticalSection _stageLock;
+        juce::Array<Stage> _stages;
+        double _sampleRate = 44100.0;
+        int _nChannels = 0;
+        std::atomic<int> _intervalMs { 10 };
+        std::atomic<int> _maxBatchSamples { 0 };
+        std::atomic<int> _overflows { 0 };
+        std::atomic<int> _maxLag { 0 };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalysisThread);
+    };
+}
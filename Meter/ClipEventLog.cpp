@@ -0,0 +1,141 @@
+/*
+  ==============================================================================
+
+    ClipEventLog.cpp
+
+  ==============================================================================
+*/
+#include "../punch.h"
+
+namespace punch {
+
+    ClipEventLog::ClipEventLog(int capacity, int maxChannels) :
+        _fifo(capacity),
+        _events(capacity),
+        _runs(maxChannels),
+        _maxChannels(maxChannels)
+    {
+        reset();
+    }
+
+    void ClipEventLog::setThresholdDb(float db)
+    {
+        _threshold = juce::Decibels::decibelsToGain(db);
+    }
+
+    void ClipEventLog::setMaxEventsPerBlock(int n)
+    {
+        _maxEventsPerBlock = juce::jmax(1, n);
+    }
+
+    void ClipEventLog::reset()
+    {
+        // Not thread safe, call while neither side is running.
+        _fifo.reset();
+        for (int c = 0; c < _maxChannels; c++) _runs[c] = Run();
+        _dropped = 0;
+    }
+
+    juce::int64 ClipEventLog::getHostPosition(juce::AudioPlayHead* playHead)
+    {
+        if (playHead != nullptr)
+            if (auto info = playHead->getPosition())
+                if (auto time = info->getTimeInSamples())
+                    return *time;
+        return -1;
+    }
+
+    void ClipEventLog::finish(Run& run, int channel, int& blockEvents)
+    {
+        run.open = false;
+        if (blockEvents >= _maxEventsPerBlock || _fifo.getFreeSpace() == 0)
+        {
+            _dropped++;
+            return;
+        }
+        blockEvents++;
+
+        int start1, size1, start2, size2;
+        _fifo.prepareToWrite(1, start1, size1, start2, size2);
+        _events[size1 > 0 ? start1 : start2] = { run.start, channel, run.length, run.peak };
+        _fifo.finishedWrite(1);
+    }
+
+    template <typename Type>
+    void ClipEventLog::scanRun(const Type* data, int nSamples, int channel, juce::int64 position)
+    {
+        if (channel < 0 || channel >= _maxChannels || nSamples <= 0) return;
+
+        auto& run = _runs[channel];
+        int blockEvents = 0;
+
+        // Without a host position the log keeps its own sample count per channel.
+        // A jump in the host timeline ends any run that was still open.
+        if (position < 0) position = run.nextPosition;
+        if (run.open && position != run.nextPosition) finish(run, channel, blockEvents);
+        run.nextPosition = position + nSamples;
+
+        const Type threshold = (Type)_threshold.load();
+        auto range = juce::FloatVectorOperations::findMinAndMax(data, nSamples);
+        if (!run.open && range.getEnd() <= threshold && range.getStart() >= -threshold) return; // nothing over
+
+        if (run.open && (range.getStart() > threshold || range.getEnd() < -threshold))
+        {
+            // the whole block continues the open run
+            run.length += nSamples;
+            run.peak = juce::jmax(run.peak, (float)juce::jmax(std::abs(range.getStart()), std::abs(range.getEnd())));
+            return;
+        }
+
+        for (int i = 0; i < nSamples; i++)
+        {
+            Type amp = std::abs(data[i]);
+            if (amp > threshold)
+            {
+                if (!run.open)
+                {
+                    run.open = true;
+                    run.start = position + i;
+                    run.length = 0;
+                    run.peak = 0.0f;
+                }
+                run.length++;
+                if ((float)amp > run.peak) run.peak = (float)amp;
+            }
+            else if (run.open)
+            {
+                finish(run, channel, blockEvents);
+            }
+        }
+    }
+
+    void ClipEventLog::scan(const float* data, int nSamples, int channel, juce::int64 position)
+    {
+        scanRun(data, nSamples, channel, position);
+    }
+
+    void ClipEventLog::scan(const double* data, int nSamples, int channel, juce::int64 position)
+    {
+        scanRun(data, nSamples, channel, position);
+    }
+
+    int ClipEventLog::drain(ClipEvent* dest, int maxEvents)
+    {
+        int start1, size1, start2, size2;
+        _fifo.prepareToRead(maxEvents, start1, size1, start2, size2);
+        for (int i = 0; i < size1; i++) dest[i] = _events[start1 + i];
+        for (int i = 0; i < size2; i++) dest[size1 + i] = _events[start2 + i];
+        _fifo.finishedRead(size1 + size2);
+        return size1 + size2;
+    }
+
+    int ClipEventLog::getNumReady()
+    {
+        return _fifo.getNumReady();
+    }
+
+    int ClipEventLog::getDropped()
+    {
+        return _dropped.load();
+    }
+}
@@ -0,0 +1,69 @@
+/*
+  ==============================================================================
+
+    ClipEventLog.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include "../punch.h"
+
+namespace punch {
+
+    struct ClipEvent
+    {
+        juce::int64 samplePosition; // first sample over the threshold
+        int channel;
+        int runLength;              // consecutive samples over the threshold
+        float peak;                 // largest magnitude in the run
+    };
+
+    /** Bounded, allocation-free log of overs written from the audio thread.
+
+        scan() finds runs of samples above the threshold, runs continue across blocks.
+        Each finished run becomes one ClipEvent in a lock-free fifo that the UI or a
+        file writer empties with drain(). When the fifo is full, or a block already
+        produced maxEventsPerBlock events, further runs are only counted as dropped.
+        scan() must always be called from the same thread.
+    */
+    class ClipEventLog
+    {
+    public:
+        ClipEventLog(int capacity = 1024, int maxChannels = 8);
+        void setThresholdDb(float db);
+        void setMaxEventsPerBlock(int n);
+        void scan(const float* data, int nSamples, int channel, juce::int64 position = -1);
+        void scan(const double* data, int nSamples, int channel, juce::int64 position = -1);
+        int drain(ClipEvent* dest, int maxEvents);
+        int getNumReady();
+        int getDropped();
+        void reset();
+
+        /** Host timeline position of the current block, or -1 when the host has none. */
+        static juce::int64 getHostPosition(juce::AudioPlayHead* playHead);
+
+    private:
+        struct Run
+        {
+            bool open = false;
+            juce::int64 start = 0;
+            int length = 0;
+            float peak = 0.0f;
+            juce::int64 nextPosition = 0;
+        };
+        template <typename Type>
+        void scanRun(const Type* data, int nSamples, int channel, juce::int64 position);
+        void finish(Run& run, int channel, int& blockEvents);
+
+        juce::AbstractFifo _fifo;
+        juce::HeapBlock<ClipEvent> _events;
+        juce::HeapBlock<Run> _runs;
+        int _maxChannels;
+        int _maxEventsPerBlock = 64;
+        std::atomic<float> _threshold { 1.0f };
+        std::atomic<int> _dropped { 0 };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ClipEventLog);
+    };
+}
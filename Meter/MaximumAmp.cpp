@@ -11,6 +11,28 @@
 
 namespace punch {
 
+    float sumOfSquares(const float* data, int nSamples)
+    {
+        // Eight independent lanes so the compiler can keep them in one vector register.
+        float acc[8] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+        int i = 0;
+        for (; i + 8 <= nSamples; i += 8)
+        {
+            for (int j = 0; j < 8; j++) acc[j] += data[i + j] * data[i + j];
+        }
+        float sum = 0.0f;
+        for (int j = 0; j < 8; j++) sum += acc[j];
+        for (; i < nSamples; i++) sum += data[i] * data[i];
+        return sum;
+    }
+
+    double sumOfSquares(const double* data, int nSamples)
+    {
+        double sum = 0.0;
+        for (int i = 0; i < nSamples; i++) sum += data[i] * data[i];
+        return sum;
+    }
+
     AmpCapture::AmpCapture(double min, double max, int nLevels, AmpType aType)
     {
         _ampType = aType;
@@ -20,7 +42,13 @@ namespace punch {
         _signal = false;
         _clipped = false;
     };
-    float AmpCapture::getMaxPeak(juce::AudioBuffer<float> amps, int channel, int startSample, int nSamples) 
+    void AmpCapture::prepare(double sampleRate, int maxBlockSize, int nChannels)
+    {
+        _sampleRate = sampleRate;
+        _maxBlockSize = maxBlockSize;
+        _nChannels = nChannels;
+    }
+    float AmpCapture::getMaxPeak(const juce::AudioBuffer<float>& amps, int channel, int startSample, int nSamples) 
     {
         float peakAmp = 0.0f;
         auto* data = amps.getReadPointer(channel);
@@ -34,7 +62,7 @@ namespace punch {
         if (std::abs(data[startSample + nSamples - 1]) > peakAmp) peakAmp = std::abs(data[startSample + nSamples - 1]);
         return peakAmp;
     };
-    double AmpCapture::getMaxPeak(juce::AudioBuffer<double> amps, int channel, int startSample, int nSamples) 
+    double AmpCapture::getMaxPeak(const juce::AudioBuffer<double>& amps, int channel, int startSample, int nSamples) 
     {
         double peakAmp = 0.0;
         auto* data = amps.getReadPointer(channel);
@@ -51,17 +79,28 @@ namespace punch {
 
     void MaximumAmp::setNLevels(int n)
     {
-        delete _levels;
+        const juce::SpinLock::ScopedLockType lock(mutex);
         _nLevels = n;
-        _levels = new float[_nLevels];
     }
-    void MaximumAmp::capture(juce::AudioBuffer<float> amps, int channel)
+    void MaximumAmp::capture(const juce::AudioBuffer<float>& amps, int channel)
     {
+        jassert(_maxBlockSize == 0 || amps.getNumSamples() <= _maxBlockSize); // prepare with the largest block
+        jassert(_nChannels == 0 || channel < _nChannels);
+        // Only contended while setWindow or flush run, the block is then read on its own.
+        const juce::SpinLock::ScopedTryLockType windowLock(_windowMutex);
+        bool windowed = windowLock.isLocked() && _hopSize > 0 && _ampType == AmpType::RMS;
+        if (windowed) integrate(amps.getReadPointer(channel), amps.getNumSamples());
+
         const juce::SpinLock::ScopedTryLockType lock(mutex);
         if (lock.isLocked())
         {
             float db = 0;
-            if (_ampType == AmpType::RMS)
+            if (windowed)
+            {
+                db = (float)juce::jmax(_pendingDb, _windowDb);
+                _pendingDb = -144.0;
+            }
+            else if (_ampType == AmpType::RMS)
             {
                 db = juce::Decibels::gainToDecibels(amps.getRMSLevel(channel, 0, amps.getNumSamples()));
             }
@@ -72,15 +111,29 @@ namespace punch {
             if (db > _peakAmp) _peakAmp = db;
             _clipped = _clipped || (db > _maxAmp);
             _signal = _signal || (amps.getMagnitude(channel, 0, amps.getNumSamples()) > 0.0);
+            _heldSamples += amps.getNumSamples();
         }
+        if (_clipLog != nullptr) _clipLog->scan(amps.getReadPointer(channel), amps.getNumSamples(), channel, _blockPosition);
     }
-    void MaximumAmp::capture(juce::AudioBuffer<double> amps, int channel)
+    void MaximumAmp::capture(const juce::AudioBuffer<double>& amps, int channel)
     {
+        jassert(_maxBlockSize == 0 || amps.getNumSamples() <= _maxBlockSize); // prepare with the largest block
+        jassert(_nChannels == 0 || channel < _nChannels);
+        // Only contended while setWindow or flush run, the block is then read on its own.
+        const juce::SpinLock::ScopedTryLockType windowLock(_windowMutex);
+        bool windowed = windowLock.isLocked() && _hopSize > 0 && _ampType == AmpType::RMS;
+        if (windowed) integrate(amps.getReadPointer(channel), amps.getNumSamples());
+
         const juce::SpinLock::ScopedTryLockType lock(mutex);
         if (lock.isLocked())
         {
             double db = 0;
-            if (_ampType == AmpType::RMS)
+            if (windowed)
+            {
+                db = (double)juce::jmax(_pendingDb, _windowDb);
+                _pendingDb = -144.0;
+            }
+            else if (_ampType == AmpType::RMS)
             {
                 db = juce::Decibels::gainToDecibels(amps.getRMSLevel(channel, 0, amps.getNumSamples()));
             }
@@ -91,14 +144,126 @@ namespace punch {
             if (db > _peakAmp) _peakAmp = db;
             _clipped = _clipped || (db > _maxAmp);
             _signal = _signal || (amps.getMagnitude(channel, 0, amps.getNumSamples()) > 0.0);
+            _heldSamples += amps.getNumSamples();
+        }
+        if (_clipLog != nullptr) _clipLog->scan(amps.getReadPointer(channel), amps.getNumSamples(), channel, _blockPosition);
+    }
+    void MaximumAmp::prepare(double sampleRate, int maxBlockSize, int nChannels)
+    {
+        AmpCapture::prepare(sampleRate, maxBlockSize, nChannels);
+        {
+            const juce::SpinLock::ScopedLockType lock(mutex);
+            _holdSamples = sampleRate > 0.0 ? juce::jmax(1, juce::roundToInt(sampleRate * _holdMs / 1000.0)) : 0;
+            _heldSamples = 0;
+        }
+        const juce::SpinLock::ScopedLockType windowLock(_windowMutex);
+        prepareWindow();
+    }
+    void MaximumAmp::setHoldTime(double holdMs)
+    {
+        const juce::SpinLock::ScopedLockType lock(mutex);
+        _holdMs = holdMs;
+        _peakHoldTimes = juce::jmax(0, juce::roundToInt(holdMs * 60.0 / 1000.0));
+        if (_sampleRate > 0.0) _holdSamples = juce::jmax(1, juce::roundToInt(_sampleRate * holdMs / 1000.0));
+    }
+    void MaximumAmp::setWindow(double windowMs, double hopMs)
+    {
+        const juce::SpinLock::ScopedLockType windowLock(_windowMutex);
+        _windowMs = windowMs;
+        _hopMs = hopMs;
+        prepareWindow();
+    }
+    int MaximumAmp::getWindowSamples()
+    {
+        const juce::SpinLock::ScopedLockType windowLock(_windowMutex);
+        return _nHops * _hopSize;
+    }
+    void MaximumAmp::prepareWindow()
+    {
+        if (_sampleRate <= 0.0 || _windowMs <= 0.0)
+        {
+            _hopSize = 0;
+            _nHops = 0;
+            _hopSums.free();
+            return;
         }
+        int window = juce::jmax(1, juce::roundToInt(_sampleRate * _windowMs / 1000.0));
+        _hopSize = _hopMs > 0.0 ? juce::jlimit(1, window, juce::roundToInt(_sampleRate * _hopMs / 1000.0)) : window;
+        _nHops = juce::jmax(1, juce::roundToInt((double)window / (double)_hopSize));
+        _hopSums.calloc((size_t)_nHops);
+        resetWindow();
+    }
+    void MaximumAmp::resetWindow()
+    {
+        if (_nHops > 0) juce::FloatVectorOperations::clear(_hopSums.get(), _nHops);
+        _hopIndex = 0;
+        _hopCount = 0;
+        _hopSum = 0.0;
+        _windowSum = 0.0;
+        _windowDb = -144.0;
+        _pendingDb = -144.0;
+    }
+    template <typename Type>
+    void MaximumAmp::integrate(const Type* data, int nSamples)
+    {
+        int i = 0;
+        while (i < nSamples)
+        {
+            int n = juce::jmin(nSamples - i, _hopSize - _hopCount);
+            _hopSum += (double)sumOfSquares(data + i, n);
+            _hopCount += n;
+            i += n;
+            if (_hopCount < _hopSize) break;
+
+            _windowSum += _hopSum - _hopSums[_hopIndex];
+            _hopSums[_hopIndex] = _hopSum;
+            if (++_hopIndex == _nHops)
+            {
+                // Resum once per window so rounding in the running sum cannot build up.
+                _hopIndex = 0;
+                _windowSum = 0.0;
+                for (int h = 0; h < _nHops; h++) _windowSum += _hopSums[h];
+            }
+            _windowDb = juce::Decibels::gainToDecibels(std::sqrt(juce::jmax(0.0, _windowSum) / (double)(_nHops * _hopSize)), -144.0);
+            _pendingDb = juce::jmax(_pendingDb, _windowDb);
+            _hopSum = 0.0;
+            _hopCount = 0;
+        }
+    }
+    void MaximumAmp::flush()
+    {
+        const juce::SpinLock::ScopedLockType windowLock(_windowMutex);
+        if (_hopSize == 0 || _hopCount == 0) return;
+        // The oldest hop drops out as if the partial one had finished.
+        double sum = juce::jmax(0.0, _windowSum - _hopSums[_hopIndex] + _hopSum);
+        int n = (_nHops - 1) * _hopSize + _hopCount;
+        captureDb(juce::Decibels::gainToDecibels(std::sqrt(sum / (double)n), -144.0));
+        resetWindow();
+    }
+    void MaximumAmp::captureDb(double db)
+    {
+        // For engines that compute their own level, such as gain reduction.
+        const juce::SpinLock::ScopedTryLockType lock(mutex);
+        if (lock.isLocked())
+        {
+            if (db > _peakAmp) _peakAmp = db;
+            _clipped = _clipped || (db > _maxAmp);
+            _signal = _signal || (db > _minAmp);
+        }
+    }
+    void MaximumAmp::advanceHold(int nSamples)
+    {
+        const juce::SpinLock::ScopedTryLockType lock(mutex);
+        if (lock.isLocked()) _heldSamples += nSamples;
     }
-    float* MaximumAmp::getLevels()
+    MeterState MaximumAmp::getState()
     {
         const juce::SpinLock::ScopedLockType lock(mutex);
-        if (++_peakTimes > _peakHoldTimes)
+        bool expired = _holdSamples > 0 ? _heldSamples > _holdSamples : ++_peakTimes > _peakHoldTimes;
+        if (expired)
         {
             _peakTimes = 0;
+            _heldSamples = 0;
             _peakhold = -144.0;
         }
 
@@ -106,16 +271,25 @@ namespace punch {
         {
             _peakhold = _peakAmp;
             _peakTimes = 0;
+            _heldSamples = 0;
         }
 
         int l = (int)((float)(_peakAmp - _minAmp) / (_maxAmp - _minAmp) * (float)_nLevels);
         int h = (int)((float)(_peakhold - _minAmp) / (_maxAmp - _minAmp) * (float)_nLevels);
-        for (int i = 0; i < _nLevels; i++) {
-            _levels[i] = 0.0;
-            if (i == h) _levels[i] = 1.0;
-            if (i <= l) _levels[i] = 1.0;
-        }
-        return _levels;
+
+        MeterState state;
+        state.lit = juce::jlimit(0, _nLevels, l + 1);
+        state.hold = (h >= state.lit && h < _nLevels) ? h : -1;
+        state.clipped = _clipped;
+        state.signal = _signal;
+        state.level = (float)_peakAmp;
+        state.holdLevel = (float)_peakhold;
+        return state;
+    }
+    double MaximumAmp::getPeakAmp()
+    {
+        const juce::SpinLock::ScopedLockType lock(mutex);
+        return _peakAmp;
     }
     bool AmpCapture::clipped()
     {
@@ -150,22 +324,33 @@ namespace punch {
         const juce::SpinLock::ScopedTryLockType lock(_mutex);
         if (lock.isLocked())
         {
-            _isUsingDouble = isUsingDoublePrecision;
-            _maxSize = maxsize;
-            _nChannels = numChannels;
-            if (!_isUsingDouble)
-            {
-                _floatBuffer = std::make_unique<juce::AudioBuffer<float>>(_nChannels, _maxSize);
-                _doubleBuffer = std::make_unique<juce::AudioBuffer<double>>(1, 1);
-            }
-            else
-            {
-                _floatBuffer = std::make_unique<juce::AudioBuffer<float>>(1, 1);
-                _doubleBuffer = std::make_unique<juce::AudioBuffer<double>>(_nChannels, _maxSize);
-            }
-            _nSamples = 0;
+            allocate(maxsize, numChannels, isUsingDoublePrecision);
         }
     }
+    void SimpleBuffer::prepare(double sampleRate, int maxBlockSize, int numChannels, double historySeconds)
+    {
+        // One block more than the history, so the largest block always fits after a wrap.
+        int size = juce::roundToInt(sampleRate * historySeconds) + maxBlockSize + 1;
+        const juce::SpinLock::ScopedLockType lock(_mutex);
+        allocate(size, numChannels, _isUsingDouble);
+    }
+    void SimpleBuffer::allocate(int maxsize, int numChannels, bool isUsingDoublePrecision)
+    {
+        _isUsingDouble = isUsingDoublePrecision;
+        _maxSize = maxsize;
+        _nChannels = numChannels;
+        if (!_isUsingDouble)
+        {
+            _floatBuffer = std::make_unique<juce::AudioBuffer<float>>(_nChannels, _maxSize);
+            _doubleBuffer = std::make_unique<juce::AudioBuffer<double>>(1, 1);
+        }
+        else
+        {
+            _floatBuffer = std::make_unique<juce::AudioBuffer<float>>(1, 1);
+            _doubleBuffer = std::make_unique<juce::AudioBuffer<double>>(_nChannels, _maxSize);
+        }
+        _nSamples = 0;
+    }
 
     void SimpleBuffer::clear()
     {
@@ -195,14 +380,15 @@ namespace punch {
         const juce::SpinLock::ScopedLockType lock(_mutex);
         return _isUsingDouble;
     }
-    void SimpleBuffer::capture(juce::AudioBuffer<float>& amps)
+    void SimpleBuffer::capture(const juce::AudioBuffer<float>& amps)
     {
         const juce::SpinLock::ScopedTryLockType lock(_mutex);
         jassert(!_isUsingDouble);
+        jassert(amps.getNumSamples() < _maxSize); // prepare with the largest block
         if (lock.isLocked())
         {
-            int nsamps = amps.getNumSamples();
-            int nchannels = amps.getNumChannels();
+            int nsamps = juce::jmin(amps.getNumSamples(), _maxSize - 1);
+            int nchannels = juce::jmin(amps.getNumChannels(), _nChannels);
             if (nsamps + _nSamples >= _maxSize)
             {
                 // buffer overflow!!
@@ -216,14 +402,15 @@ namespace punch {
             _nSamples += nsamps;
         }
     }
-    void SimpleBuffer::capture(juce::AudioBuffer<double>& amps)
+    void SimpleBuffer::capture(const juce::AudioBuffer<double>& amps)
     {
         const juce::SpinLock::ScopedTryLockType lock(_mutex);
         jassert(_isUsingDouble);
+        jassert(amps.getNumSamples() < _maxSize); // prepare with the largest block
         if (lock.isLocked())
         {
-            int nsamps = amps.getNumSamples();
-            int nchannels = amps.getNumChannels();
+            int nsamps = juce::jmin(amps.getNumSamples(), _maxSize - 1);
+            int nchannels = juce::jmin(amps.getNumChannels(), _nChannels);
             if (nsamps + _nSamples >= _maxSize)
             {
                 // buffer overflow!!
@@ -237,7 +424,7 @@ namespace punch {
             _nSamples += nsamps;
         }
     }
-    void SimpleBuffer::append(juce::AudioBuffer<float>& amps, int nsamps)
+    void SimpleBuffer::append(const juce::AudioBuffer<float>& amps, int nsamps)
     {
         const juce::SpinLock::ScopedTryLockType lock(_mutex);
         jassert(!_isUsingDouble);
@@ -288,32 +475,61 @@ namespace punch {
     {
         return _floatBuffer->getWritePointer(channel);
     }
+    int SimpleBuffer::copyLatest(int channel, float* dest, int nSamples)
+    {
+        // Copies up to nSamples of the most recent history for channel, oldest first.
+        const juce::SpinLock::ScopedLockType lock(_mutex);
+        if (_maxSize == 0 || channel >= _nChannels) return 0;
+        int n = juce::jmin(nSamples, _nSamples);
+        int start = _nSamples - n;
+        if (!_isUsingDouble)
+        {
+            juce::FloatVectorOperations::copy(dest, _floatBuffer->getReadPointer(channel, start), n);
+        }
+        else
+        {
+            auto readptr = _doubleBuffer->getReadPointer(channel, start);
+            for (int i = 0; i < n; i++) dest[i] = (float)readptr[i];
+        }
+        return n;
+    }
     void CompareBuffer::init(int maxsize, int numChannels, bool isUsingDoublePrecision)
     {
         const juce::SpinLock::ScopedTryLockType lock(_mutex);
         if (lock.isLocked())
         {
-            _isUsingDouble = isUsingDoublePrecision;
-            _maxSize = maxsize;
-            _nChannels = numChannels;
-            if (!_isUsingDouble)
-            {
-                _floatBeforeBuffer = std::make_unique<juce::AudioBuffer<float>>(_nChannels, _maxSize);
-                _doubleBeforeBuffer = std::make_unique<juce::AudioBuffer<double>>(1, 1);
-                _floatAfterBuffer = std::make_unique<juce::AudioBuffer<float>>(_nChannels, _maxSize);
-                _doubleAfterBuffer = std::make_unique<juce::AudioBuffer<double>>(1, 1);
-            }
-            else
-            {
-                _floatBeforeBuffer = std::make_unique<juce::AudioBuffer<float>>(1, 1);
-                _doubleBeforeBuffer = std::make_unique<juce::AudioBuffer<double>>(_nChannels, _maxSize);
-                _floatAfterBuffer = std::make_unique<juce::AudioBuffer<float>>(1, 1);
-                _doubleAfterBuffer = std::make_unique<juce::AudioBuffer<double>>(_nChannels, _maxSize);
-            }
-            _nSamples = 0;
-            _latencySamples = 0;
+            allocate(maxsize, numChannels, isUsingDoublePrecision);
         }
     }
+    void CompareBuffer::prepare(double sampleRate, int maxBlockSize, int numChannels, double historySeconds)
+    {
+        int size = juce::roundToInt(sampleRate * historySeconds) + maxBlockSize + 1;
+        const juce::SpinLock::ScopedLockType lock(_mutex);
+        allocate(size, numChannels, _isUsingDouble);
+    }
+    void CompareBuffer::allocate(int maxsize, int numChannels, bool isUsingDoublePrecision)
+    {
+        _isUsingDouble = isUsingDoublePrecision;
+        _maxSize = maxsize;
+        _nChannels = numChannels;
+        if (!_isUsingDouble)
+        {
+            _floatBeforeBuffer = std::make_unique<juce::AudioBuffer<float>>(_nChannels, _maxSize);
+            _doubleBeforeBuffer = std::make_unique<juce::AudioBuffer<double>>(1, 1);
+            _floatAfterBuffer = std::make_unique<juce::AudioBuffer<float>>(_nChannels, _maxSize);
+            _doubleAfterBuffer = std::make_unique<juce::AudioBuffer<double>>(1, 1);
+        }
+        else
+        {
+            _floatBeforeBuffer = std::make_unique<juce::AudioBuffer<float>>(1, 1);
+            _doubleBeforeBuffer = std::make_unique<juce::AudioBuffer<double>>(_nChannels, _maxSize);
+            _floatAfterBuffer = std::make_unique<juce::AudioBuffer<float>>(1, 1);
+            _doubleAfterBuffer = std::make_unique<juce::AudioBuffer<double>>(_nChannels, _maxSize);
+        }
+        _nSamples = 0;
+        _latencySamples = 0;
+        _written = 0;
+    }
 
     void CompareBuffer::clear()
     {
@@ -348,15 +564,16 @@ namespace punch {
         const juce::SpinLock::ScopedLockType lock(_mutex);
         return _isUsingDouble;
     }
-    void CompareBuffer::capture(juce::AudioBuffer<float>& bamps, juce::AudioBuffer<float>& aamps, int latency)
+    void CompareBuffer::capture(const juce::AudioBuffer<float>& bamps, const juce::AudioBuffer<float>& aamps, int latency)
     {
         const juce::SpinLock::ScopedTryLockType lock(_mutex);
         jassert(!_isUsingDouble);
+        jassert(bamps.getNumSamples() < _maxSize); // prepare with the largest block
         if (lock.isLocked())
         {
             _latencySamples = latency;
-            int nsamps = bamps.getNumSamples();
-            int nchannels = bamps.getNumChannels();
+            int nsamps = juce::jmin(bamps.getNumSamples(), _maxSize - 1);
+            int nchannels = juce::jmin(bamps.getNumChannels(), _nChannels);
             if (nsamps + _nSamples >= _maxSize)
             {
                 // buffer overflow!!
@@ -368,9 +585,14 @@ namespace punch {
                 _floatAfterBuffer->copyFrom(c, _nSamples, aamps, c, 0, nsamps);
             }
             _nSamples += nsamps;
+            _written += nsamps;
+        }
+        else
+        {
+            _missed++;
         }
     }
-    void CompareBuffer::capture(juce::AudioBuffer<double>& bamps, juce::AudioBuffer<double>& aamps, int latency)
+    void CompareBuffer::capture(const juce::AudioBuffer<double>& bamps, const juce::AudioBuffer<double>& aamps, int latency)
     {
         const juce::SpinLock::ScopedTryLockType lock(_mutex);
         jassert(false); // double not supported
@@ -394,6 +616,11 @@ namespace punch {
                 _floatAfterBuffer->copyFrom(c, _nSamples, readptr, nsamps);
             }
             _nSamples += nsamps;
+            _written += nsamps;
+        }
+        else
+        {
+            _missed++;
         }
     }
     void CompareBuffer::trimStart(int size)
@@ -412,6 +639,26 @@ namespace punch {
         }
     }
 
+    int CompareBuffer::read(int channel, juce::int64& position, float* before, float* after, int maxSamples, bool& skipped)
+    {
+        const juce::SpinLock::ScopedLockType lock(_mutex);
+        skipped = false;
+        if (_maxSize == 0 || channel >= _nChannels) return 0;
+
+        juce::int64 oldest = _written - _nSamples;
+        if (position < oldest || position > _written)
+        {
+            skipped = true;
+            position = oldest;
+        }
+        int n = (int)juce::jmin((juce::int64)maxSamples, _written - position);
+        int start = (int)(position - oldest);
+        juce::FloatVectorOperations::copy(before, _floatBeforeBuffer->getReadPointer(channel, start), n);
+        juce::FloatVectorOperations::copy(after, _floatAfterBuffer->getReadPointer(channel, start), n);
+        position += n;
+        return n;
+    }
+
     const float* CompareBuffer::getBeforeReadPtr(int channel)
     {
         return _floatBeforeBuffer->getReadPointer(channel);
@@ -421,6 +668,104 @@ namespace punch {
     {
         return _floatAfterBuffer->getReadPointer(channel);
     }
+    void GainReductionAmp::init(int windowSize, int maxLatency)
+    {
+        _windowSize = juce::jmax(1, windowSize);
+        _maxLatency = juce::jmax(0, maxLatency);
+        _history.calloc(juce::jmax(1, _maxLatency));
+        _before.malloc(_windowSize);
+        _after.malloc(_windowSize);
+        _comparePosition = -1;
+        clear();
+    }
+
+    void GainReductionAmp::clear()
+    {
+        _windowCount = 0;
+        _sumBefore = 0.0;
+        _sumAfter = 0.0;
+        if (_maxLatency > 0) juce::FloatVectorOperations::clear(_history, _maxLatency);
+    }
+
+    void GainReductionAmp::pushHistory(const float* before, int nSamples)
+    {
+        // Keeps the last _maxLatency before samples, oldest first.
+        if (_maxLatency == 0) return;
+        if (nSamples >= _maxLatency)
+        {
+            juce::FloatVectorOperations::copy(_history, before + nSamples - _maxLatency, _maxLatency);
+        }
+        else
+        {
+            memmove(_history, _history + nSamples, (size_t)(_maxLatency - nSamples) * sizeof(float));
+            juce::FloatVectorOperations::copy(_history + _maxLatency - nSamples, before, nSamples);
+        }
+    }
+
+    double GainReductionAmp::capture(const float* before, const float* after, int nSamples, int latency)
+    {
+        if (_windowSize == 0) return -1.0; // init not called
+        jassert(latency <= _maxLatency);
+        latency = juce::jlimit(0, _maxLatency, latency);
+
+        double maxReduction = -1.0;
+        int i = 0;
+        while (i < nSamples)
+        {
+            int n = juce::jmin(nSamples - i, _windowSize - _windowCount);
+            _sumAfter += sumOfSquares(after + i, n);
+
+            // Before samples aligned with after[i, i+n) are before[i-latency, i+n-latency),
+            // the negative part of which is still in the history.
+            int k0 = i - latency;
+            int k1 = i + n - latency;
+            if (k0 < 0) _sumBefore += sumOfSquares(_history + _maxLatency + k0, juce::jmin(k1, 0) - k0);
+            if (k1 > 0) _sumBefore += sumOfSquares(before + juce::jmax(k0, 0), k1 - juce::jmax(k0, 0));
+
+            _windowCount += n;
+            i += n;
+            if (_windowCount == _windowSize)
+            {
+                double reduction = 0.0;
+                if (_sumBefore > 1.0e-12 && _sumAfter < _sumBefore)
+                {
+                    reduction = -juce::Decibels::gainToDecibels(std::sqrt(_sumAfter / _sumBefore), -144.0);
+                }
+                maxReduction = juce::jmax(maxReduction, reduction);
+                _windowCount = 0;
+                _sumBefore = 0.0;
+                _sumAfter = 0.0;
+            }
+        }
+        pushHistory(before, nSamples);
+        return maxReduction;
+    }
+
+    double GainReductionAmp::capture(CompareBuffer& buffer, int channel, int* nSamplesRead)
+    {
+        // Picks up where the last call stopped. Lost samples would shift the after
+        // stream against the delayed before stream, so the alignment starts over.
+        if (_windowSize == 0) return -1.0; // init not called
+        int latency = buffer.getLatencySamples();
+        int missed = buffer.getMissedBlocks();
+        bool restart = missed != _compareMissed;
+        _compareMissed = missed;
+
+        double maxReduction = -1.0;
+        if (nSamplesRead != nullptr) *nSamplesRead = 0;
+        for (;;)
+        {
+            bool skipped = false;
+            int n = buffer.read(channel, _comparePosition, _before, _after, _windowSize, skipped);
+            if (skipped || restart) clear();
+            restart = false;
+            if (n == 0) break;
+            if (nSamplesRead != nullptr) *nSamplesRead += n;
+            maxReduction = juce::jmax(maxReduction, capture(_before, _after, n, latency));
+        }
+        return maxReduction;
+    }
+
     class VUHistogram
     {
     public:
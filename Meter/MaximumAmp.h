@@ -13,18 +13,40 @@
 
 namespace punch {
 
+    float sumOfSquares(const float* data, int nSamples);
+    double sumOfSquares(const double* data, int nSamples);
+
     enum AmpType {
         RMS, Peak
     };
 
+    /** What a meter needs to draw one frame: lights 0 to lit-1 are on, plus the
+        hold light when it sits above them. level and holdLevel are the same in dB
+        for meters that draw without lights.
+    */
+    struct MeterState
+    {
+        int lit = 0;
+        int hold = -1;
+        bool clipped = false;
+        bool signal = false;
+        float level = -144.0f;
+        float holdLevel = -144.0f;
+    };
+
     class AmpCapture
     {
     public:
         AmpCapture(double minAmp, double maxAmp, int nLevels, AmpType ampType = AmpType::Peak);
-        virtual void capture(juce::AudioBuffer<float> amps, int channel) = 0;
-        virtual void capture(juce::AudioBuffer<double> amps, int channel) = 0;
+        virtual ~AmpCapture() = default;
+        /** Call from prepareToPlay. Sizes everything for blocks of up to maxBlockSize
+            samples and works out the time constants, capture never allocates after it.
+        */
+        virtual void prepare(double sampleRate, int maxBlockSize, int nChannels);
+        virtual void capture(const juce::AudioBuffer<float>& amps, int channel) = 0;
+        virtual void capture(const juce::AudioBuffer<double>& amps, int channel) = 0;
         virtual void clear() = 0;
-        virtual float* getLevels() = 0;        
+        virtual MeterState getState() = 0;
         virtual void setNLevels(int n) = 0;
         double getMinAmp() { return _minAmp; }
         double getMaxAmp() { return _maxAmp; }
@@ -32,17 +54,26 @@ namespace punch {
         void setClipped(bool);
         bool signal();
         int getNLevels() { return _nLevels; }
+        double getSampleRate() { return _sampleRate; }
+        int getMaxBlockSize() { return _maxBlockSize; }
+        void setClipEventLog(ClipEventLog* log) { _clipLog = log; }
+        void setBlockPosition(juce::int64 position) { _blockPosition = position; }
 
     protected:
-        float getMaxPeak(juce::AudioBuffer<float> amps, int channel, int startSample, int nSamples);
-        double getMaxPeak(juce::AudioBuffer<double> amps, int channel, int startSample, int nSamples);
+        float getMaxPeak(const juce::AudioBuffer<float>& amps, int channel, int startSample, int nSamples);
+        double getMaxPeak(const juce::AudioBuffer<double>& amps, int channel, int startSample, int nSamples);
         AmpType _ampType;
+        double _sampleRate = 0.0;
+        int _maxBlockSize = 0;
+        int _nChannels = 0;
         double  _minAmp;
         double _maxAmp;
         int _nLevels;
         juce::SpinLock mutex;
         bool _signal;
         bool _clipped;
+        ClipEventLog* _clipLog = nullptr;
+        juce::int64 _blockPosition = -1;
     };
 
     class HistogramAmp : public AmpCapture
@@ -52,16 +83,14 @@ namespace punch {
             AmpCapture(minAmp, maxAmp, nLevels) 
         {
             _peakHoldTimes = 10;
-            _levels = new float[_nLevels];
         };
-        void capture(juce::AudioBuffer<float> amps, int channel) override;
-        void capture(juce::AudioBuffer<double> amps, int channel) override;
+        void capture(const juce::AudioBuffer<float>& amps, int channel) override;
+        void capture(const juce::AudioBuffer<double>& amps, int channel) override;
         void clear() override;
-        float* getLevels() override;
+        MeterState getState() override;
         void setNLevels(int n) override;
     private:
         double _peakAmp;
-        float* _levels;
         int _peakHoldTimes;
         int _lastlight = 0;
         double _peakhold = 0.0;
@@ -71,42 +100,87 @@ namespace punch {
     class MaximumAmp : public AmpCapture
     {
     public:
-        MaximumAmp(double minAmp, double maxAmp, int nLevels) :
-            AmpCapture(minAmp, maxAmp, nLevels)
+        MaximumAmp(double minAmp, double maxAmp, int nLevels, AmpType ampType = AmpType::Peak) :
+            AmpCapture(minAmp, maxAmp, nLevels, ampType)
         {
-            _levels = new float[_nLevels];
             _peakHoldTimes = 10;
         };
-        void capture(juce::AudioBuffer<float> amps, int channel) override;
-        void capture(juce::AudioBuffer<double> amps, int channel) override;
+        void capture(const juce::AudioBuffer<float>& amps, int channel) override;
+        void capture(const juce::AudioBuffer<double>& amps, int channel) override;
+        void prepare(double sampleRate, int maxBlockSize, int nChannels) override;
         void clear() override;
-        float* getLevels() override;
+        MeterState getState() override;
         void setNLevels(int n) override;
+        void captureDb(double db);
+        /** For engines that feed captureDb, the samples the readings covered. */
+        void advanceHold(int nSamples);
+        double getPeakAmp();
+        /** How long the hold light stays up. Counted in captured samples once
+            prepared, in getState calls before that.
+        */
+        void setHoldTime(double holdMs);
+
+        /** RMS over a fixed window of windowMs instead of over each host block.
+            The window slides in hops of hopMs, a hopMs of 0 gives back to back
+            windows. Partial hops carry over to the next capture, so readings do not
+            depend on the block size. Takes effect once prepared. It allocates, so
+            call it from the message thread, blocks captured meanwhile are read on
+            their own. A windowMs of 0 goes back to one reading per block. Peak
+            readings are sample exact either way.
+        */
+        void setWindow(double windowMs, double hopMs = 5.0);
+        int getWindowSamples();
+        /** End of stream, the unfinished hop is read as a shorter last hop. */
+        void flush();
     private:
-        double _peakAmp;
-        float* _levels;
+        template <typename Type>
+        void integrate(const Type* data, int nSamples);
+        void prepareWindow();
+        void resetWindow();
+        double _peakAmp = -144.0;
         int _peakHoldTimes;
         int _lastlight = 0;
         double _peakhold = 0.0;
         int _peakTimes = 0;
+        double _holdMs = 1000.0 * 10.0 / 60.0;  // ten frames at 60 Hz
+        int _holdSamples = 0;               // 0 until prepared
+        juce::int64 _heldSamples = 0;       // captured since the hold was set
+        double _windowMs = 0.0;
+        double _hopMs = 5.0;
+        juce::HeapBlock<double> _hopSums;   // sum of squares of each hop in the window
+        int _nHops = 0;
+        int _hopSize = 0;                   // 0 when integrating per block
+        int _hopIndex = 0;                  // slot the next finished hop replaces
+        int _hopCount = 0;                  // samples in the unfinished hop
+        double _hopSum = 0.0;
+        double _windowSum = 0.0;
+        double _windowDb = -144.0;          // latest finished window
+        double _pendingDb = -144.0;         // loudest window not yet taken under the lock
+        juce::SpinLock _windowMutex;        // guards the window, taken before mutex
     };
     class SimpleBuffer
     {
     public:
         SimpleBuffer() { _maxSize = 0; };
         void init(int size, int nChannels, bool isUsingDouble);
-        void capture(juce::AudioBuffer<float>& amps);
-        void capture(juce::AudioBuffer<double>& amps);
+        /** Call from prepareToPlay. Holds historySeconds plus one block of up to
+            maxBlockSize, in the precision last given to init, so capture never
+            allocates or overruns.
+        */
+        void prepare(double sampleRate, int maxBlockSize, int nChannels, double historySeconds = 1.0);
+        void capture(const juce::AudioBuffer<float>& amps);
+        void capture(const juce::AudioBuffer<double>& amps);
         void clear();
         int getNSamples();
         int getSize();
         int getNChannels();
         bool getIsUsingDouble();
         juce::AudioBuffer<float> *getBuffer();
-        void append(juce::AudioBuffer<float>& amps, int n);
+        void append(const juce::AudioBuffer<float>& amps, int n);
         void trimStart(int size);
         const float* getChannelReadPtr(int channel);
         const float* getChannelWritePtr(int channel);
+        int copyLatest(int channel, float* dest, int nSamples);
         void dump(std::string pre)
         {
             int a = 0;
@@ -125,13 +199,14 @@ namespace punch {
             return;
         };
     private:
+        void allocate(int size, int nChannels, bool isUsingDouble);
         std::unique_ptr<juce::AudioBuffer<float>> _floatBuffer;
         std::unique_ptr<juce::AudioBuffer<double>> _doubleBuffer;
         juce::SpinLock _mutex;
         int _maxSize;
-        int _nSamples;
-        int _nChannels;
-        bool _isUsingDouble;
+        int _nSamples = 0;
+        int _nChannels = 0;
+        bool _isUsingDouble = false;
     };
 
     class CompareBuffer
@@ -139,13 +214,16 @@ namespace punch {
     public:
         CompareBuffer() { _maxSize = 0; };
         void init(int size, int nChannels, bool isUsingDouble);
-        void capture(juce::AudioBuffer<float>& bamps, juce::AudioBuffer<float>& aamps, int latency);
-        void capture(juce::AudioBuffer<double>& bamps, juce::AudioBuffer<double>& aamps, int latency);
+        /** As SimpleBuffer::prepare, for both the before and after streams. */
+        void prepare(double sampleRate, int maxBlockSize, int nChannels, double historySeconds = 1.0);
+        void capture(const juce::AudioBuffer<float>& bamps, const juce::AudioBuffer<float>& aamps, int latency);
+        void capture(const juce::AudioBuffer<double>& bamps, const juce::AudioBuffer<double>& aamps, int latency);
         void clear();
         int getNSamples();
         int getSize();
         int getNChannels();
         int getLatencySamples();
+        int getMissedBlocks() { return _missed.load(); }
         bool getIsUsingDouble();
         juce::AudioBuffer<float>* getBuffer();
         void append(CompareBuffer* amps, int n);
@@ -153,7 +231,15 @@ namespace punch {
         const float* getBeforeReadPtr(int channel);
         const float* getAfterReadPtr(int channel);
 
+        /** Copies up to maxSamples of channel from stream position onwards, under the
+            lock, and advances position. skipped is set when samples from position
+            on were lost to an overflow, a clear or a missed block, and position then
+            jumps to the oldest sample still held.
+        */
+        int read(int channel, juce::int64& position, float* before, float* after, int maxSamples, bool& skipped);
+
     private:  
+        void allocate(int size, int nChannels, bool isUsingDouble);
         std::unique_ptr<juce::AudioBuffer<float>> _floatBeforeBuffer;
         std::unique_ptr<juce::AudioBuffer<double>> _doubleBeforeBuffer;
         std::unique_ptr<juce::AudioBuffer<float>> _floatAfterBuffer;
@@ -161,8 +247,40 @@ namespace punch {
         juce::SpinLock _mutex;
         int _latencySamples = 0;
         int _maxSize;
-        int _nSamples;
-        int _nChannels;
-        bool _isUsingDouble;
+        int _nSamples = 0;
+        int _nChannels = 0;
+        bool _isUsingDouble = false;
+        juce::int64 _written = 0;           // stream position after the newest sample
+        std::atomic<int> _missed { 0 };     // blocks dropped because the lock was held
+    };
+
+    /** Gain reduction of one channel from matching before/after streams.
+
+        The before stream is delayed by the processor latency so both sides of each
+        window see the same audio. capture() returns the largest reduction in dB of
+        the windows completed during the call, or -1 if none completed. Reading a
+        CompareBuffer copies out under its lock, and restarts the alignment when
+        samples were lost in between.
+    */
+    class GainReductionAmp
+    {
+    public:
+        GainReductionAmp() {};
+        void init(int windowSize, int maxLatency);
+        double capture(const float* before, const float* after, int nSamples, int latency);
+        double capture(CompareBuffer& buffer, int channel, int* nSamplesRead = nullptr);
+        void clear();
+    private:
+        void pushHistory(const float* before, int nSamples);
+        juce::HeapBlock<float> _history;
+        juce::HeapBlock<float> _before;     // copied out of a CompareBuffer
+        juce::HeapBlock<float> _after;
+        int _maxLatency = 0;
+        int _windowSize = 0;
+        int _windowCount = 0;
+        juce::int64 _comparePosition = -1;
+        int _compareMissed = 0;
+        double _sumBefore = 0.0;
+        double _sumAfter = 0.0;
     };
 }
\ No newline at end of file
@@ -21,7 +21,6 @@ namespace punch {
     {
         _leftAnnoWidth = leftAnnoWidth;
         _rightAnnoWidth = rightAnnoWidth;
-        //startTimerHz(100);
         addAndMakeVisible(leftLevelMeter);
         addAndMakeVisible(rightLevelMeter);
         if (leftAnnoWidth > 0.0) addAndMakeVisible(leftAnno);
@@ -34,11 +33,6 @@ namespace punch {
         return leftLevelMeter.canSetRange() || rightLevelMeter.canSetRange();
     };
 
-    void StereoLevelMeter::timerCallback()
-    {
-        repaint();
-    };
-
     int StereoLevelMeter::getNChannels()
     {
         return _isMono ? 1 : 2;
@@ -101,29 +95,47 @@ namespace punch {
         {
             leftLevelMeter.setOrangeLevel((float)r.getStart());
             leftLevelMeter.setRedLevel((float)r.getEnd());
-            leftLevelMeter.setHeight(getBounds().getHeight());
         }
         if (rightLevelMeter.canSetRange())
         {
             rightLevelMeter.setOrangeLevel((float)r.getStart());
             rightLevelMeter.setRedLevel((float)r.getEnd());
-            rightLevelMeter.setHeight(getBounds().getHeight());
-
         }
     }
-    void StereoLevelMeter::capture(juce::AudioBuffer<float> amps)
+    void StereoLevelMeter::setPreRender(bool shouldPreRender)
+    {
+        leftLevelMeter.setPreRender(shouldPreRender);
+        rightLevelMeter.setPreRender(shouldPreRender);
+    }
+    void StereoLevelMeter::setClipEventLog(ClipEventLog* log)
+    {
+        leftLevelMeter.maxAmp.setClipEventLog(log);
+        rightLevelMeter.maxAmp.setClipEventLog(log);
+    }
+    void StereoLevelMeter::prepare(double sampleRate, int maxBlockSize)
+    {
+        leftLevelMeter.prepare(sampleRate, maxBlockSize);
+        rightLevelMeter.prepare(sampleRate, maxBlockSize);
+    }
+    void StereoLevelMeter::capture(const juce::AudioBuffer<float>& amps, juce::int64 samplePosition)
     {
         if (amps.getNumChannels() == 0) return;
 
+        leftLevelMeter.maxAmp.setBlockPosition(samplePosition);
+        rightLevelMeter.maxAmp.setBlockPosition(samplePosition);
+
         leftLevelMeter.capture(amps, 0); 
         _isMono = amps.getNumChannels() == 1;
 
         if (!_isMono) rightLevelMeter.capture(amps, 1);
     };
-    void StereoLevelMeter::capture(juce::AudioBuffer<double> amps)
+    void StereoLevelMeter::capture(const juce::AudioBuffer<double>& amps, juce::int64 samplePosition)
     {
         if (amps.getNumChannels() == 0) return;
 
+        leftLevelMeter.maxAmp.setBlockPosition(samplePosition);
+        rightLevelMeter.maxAmp.setBlockPosition(samplePosition);
+
         leftLevelMeter.capture(amps, 0);
         _isMono = amps.getNumChannels() == 1;
 
@@ -137,33 +149,301 @@ namespace punch {
         //g.setColour(juce::Colours::red);
         //g.drawRect(0, 0, getBounds().getWidth(), getBounds().getHeight(), 1.0);
 
-        auto levels = maxAmp.getLevels();
+        float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        if (_preRender)
+        {
+            _renderScale = scale;
+            const juce::SpinLock::ScopedLockType frameLock(_frameLock);
+            if (_frame.isValid() && _frameGeneration == _generation)
+            {
+                g.drawImageTransformed(_frame, juce::AffineTransform::scale(1.0f / _frameScale));
+                return;
+            }
+        }
+
+        // Without pre-rendering, or before the first frame is finished, draw here.
+        // Snapshots are only taken in refresh(), so a host or overlapping repaint
+        // redraws the current state without clearing a peak from the amp.
+        const juce::ScopedLock lock(_renderLock);
+        prepareFrame(scale);
+        renderFrame(g, scale);
+    };
+
+    void LevelMeter::prepareFrame(float scale)
+    {
+        _layoutWidth = getWidth();
+        _layoutHeight = getHeight();
+        prepareCaches(scale);
+
+        // The unlit meter only changes with size, zones or display scale, so it is
+        // rendered once and each frame only draws the lights that are on.
+        int bw = juce::jmax(1, juce::roundToInt((float)_layoutWidth * scale));
+        int bh = juce::jmax(1, juce::roundToInt((float)_layoutHeight * scale));
+        bool resize = scale != _backgroundScale || _background.getWidth() != bw || _background.getHeight() != bh;
+        if (resize || _backgroundDirty)
+        {
+            // zone and range changes redraw into the same image, only a new size allocates
+            if (resize) _background = juce::Image(juce::Image::ARGB, bw, bh, true);
+            else _background.clear(_background.getBounds());
+            juce::Graphics bg(_background);
+            bg.addTransform(juce::AffineTransform::scale(scale));
+            drawBackground(bg);
+            _backgroundScale = scale;
+            _backgroundDirty = false;
+        }
+        _jobGeneration = _generation;
+    }
+
+    void LevelMeter::renderFrame(juce::Graphics& g, float)
+    {
+        g.drawImageTransformed(_background, juce::AffineTransform::scale(1.0f / _backgroundScale));
+
+        int tx = getLightX();
+        if (_state.clipped) drawClipped(g, tx, getClippedY(), _lightwidth, _clippedheight, true);
+
+        drawLitLights(g);
+
+        if (_state.signal) drawSignal(g, tx, getSignalY(), _lightwidth, _signalheight, true);
+    }
+
+    void LevelMeter::takeSnapshot()
+    {
+        jassert(!_rendering); // a worker is drawing from _state
+        _state = maxAmp.getState();
         _nLights = maxAmp.getNLevels();
+        maxAmp.clear();
+    }
 
-        int y = _mTop;
-        int centerx = getBounds().getWidth() / 2;
+    void LevelMeter::refresh()
+    {
+        // Called by the shared RefreshScheduler each frame. Hidden meters keep
+        // accumulating and pick up their peaks once they are shown again.
+        if (!isShowing()) return;
 
-        int tx = centerx - _lightwidth / 2;
+        if (_preRender)
+        {
+            // Show the frame the workers finished, then queue the next one. While a
+            // frame is being drawn the amp keeps accumulating, so no peak is lost.
+            if (_frameReady.exchange(false))
+            {
+                _shown = _state;
+                repaint(_pendingDirty);
+            }
+            // the pool may still be retiring the last job after it set _rendering
+            if (_rendering || _renderPool->contains(&_renderJob)) return;
+        }
+
+        takeSnapshot();
+        {
+            // no frame is in flight here, so this never waits on a worker
+            const juce::ScopedLock lock(_renderLock);
+            _layoutWidth = getWidth();
+            _layoutHeight = getHeight();
+        }
+
+        // Compare against what is on screen, not the previous snapshot, so a paint
+        // that has not happened yet still covers every change since the last one.
+        auto dirty = getChangedLights();
+        if (_state.clipped != _shown.clipped) dirty = dirty.getUnion({ getLightX(), getClippedY(), _lightwidth, _clippedheight });
+        if (_state.signal != _shown.signal) dirty = dirty.getUnion({ getLightX(), getSignalY(), _lightwidth, _signalheight });
+        if (dirty.isEmpty()) return;
+
+        if (_preRender)
+        {
+            {
+                const juce::ScopedLock lock(_renderLock);
+                _jobScale = _renderScale.load();
+                prepareFrame(_jobScale);
+            }
+            _pendingDirty = dirty;
+            _rendering = true;
+            _renderPool->addJob(&_renderJob);
+        }
+        else
+        {
+            // the dirty rect covers every light that differs, so once it is painted
+            // the screen shows _state
+            _shown = _state;
+            repaint(dirty);
+        }
+    }
 
-        drawClipped(g, tx, _mTop - 6 - _clippedheight, _lightwidth, _clippedheight, maxAmp.clipped());
+    LevelMeter::~LevelMeter()
+    {
+        setPreRender(false);
+    }
 
+    void LevelMeter::setPreRender(bool shouldPreRender)
+    {
+        if (shouldPreRender == _preRender) return;
+        if (!shouldPreRender) _renderPool->waitForJob(&_renderJob);
+        _preRender = shouldPreRender;
+        _rendering = false;
+        _frameReady = false;
+        {
+            const juce::SpinLock::ScopedLockType frameLock(_frameLock);
+            _frame = juce::Image();
+        }
+        _nextFrame = juce::Image();
+        repaint();
+    }
+
+    juce::ThreadPoolJob::JobStatus LevelMeter::RenderJob::runJob()
+    {
+        meter.renderOffThread();
+        return jobHasFinished;
+    }
+
+    void LevelMeter::renderOffThread()
+    {
+        {
+            // Only the size, scale, state and caches captured by prepareFrame are read here.
+            const juce::ScopedLock lock(_renderLock);
+            float scale = _jobScale;
+            int fw = juce::jmax(1, juce::roundToInt((float)_layoutWidth * scale));
+            int fh = juce::jmax(1, juce::roundToInt((float)_layoutHeight * scale));
+            if (_nextFrame.getWidth() != fw || _nextFrame.getHeight() != fh)
+            {
+                // software images, so the worker never touches a GPU context
+                _nextFrame = juce::Image(juce::Image::ARGB, fw, fh, true, juce::SoftwareImageType());
+            }
+            else _nextFrame.clear(_nextFrame.getBounds());
+
+            juce::Graphics g(_nextFrame);
+            g.addTransform(juce::AffineTransform::scale(scale));
+            renderFrame(g, scale);
+
+            const juce::SpinLock::ScopedLockType frameLock(_frameLock);
+            std::swap(_frame, _nextFrame);
+            _frameScale = scale;
+            _frameGeneration = _jobGeneration;
+        }
+        _frameReady = true;
+        _rendering = false;
+    }
+
+    juce::Rectangle<int> LevelMeter::getChangedLights()
+    {
+        juce::Rectangle<int> dirty;
+        int lo = juce::jmin(_state.lit, _shown.lit);
+        int hi = juce::jmax(_state.lit, _shown.lit);
+        if (lo < hi) dirty = getLightBounds(lo).getUnion(getLightBounds(hi - 1));
+        if (_state.hold != _shown.hold)
+        {
+            if (_state.hold >= 0) dirty = dirty.getUnion(getLightBounds(_state.hold));
+            if (_shown.hold >= 0) dirty = dirty.getUnion(getLightBounds(_shown.hold));
+        }
+        return dirty;
+    }
+
+    juce::Rectangle<int> LevelMeter::getLightBounds(int l)
+    {
+        return { getLightX(), getLightY(l), _lightwidth, _lightheight };
+    }
+
+    void LevelMeter::drawLitLights(juce::Graphics& g)
+    {
+        int tx = getLightX();
+        for (int l = 0; l < _state.lit; l++)
+        {
+            drawLight(g, tx, getLightY(l), _lightwidth, _lightheight, true, l);
+        }
+        if (_state.hold >= 0) drawLight(g, tx, getLightY(_state.hold), _lightwidth, _lightheight, true, _state.hold);
+    }
+
+    void LevelMeter::fillLights(juce::Graphics& g, int inset)
+    {
+        // Lit lights are gathered per colour zone and filled with one call each,
+        // rather than a colour change and a fill for every light.
+        int starts[] = { 0, _orangeStart.load(), _redStart.load(), _nLights };
+        const Zone zones[] = { Green, Orange, Red };
+        for (int z = 0; z < 3; z++)
+        {
+            for (int l = starts[z]; l < juce::jmin(starts[z + 1], _state.lit); l++)
+                _litRects.addWithoutMerging(getLightBounds(l).reduced(inset));
+            if (_state.hold >= starts[z] && _state.hold < starts[z + 1])
+                _litRects.addWithoutMerging(getLightBounds(_state.hold).reduced(inset));
+            if (_litRects.isEmpty()) continue;
+            g.setColour(_zoneColours[zones[z]]);
+            g.fillRectList(_litRects);
+            _litRects.clear();
+        }
+    }
+
+    void LevelMeter::updateZones(float orangeLevel, float redLevel)
+    {
+        // Each light takes the zone its centre falls in. Only two indices change,
+        // so a zone drag neither allocates nor touches a per-light table.
+        auto mindb = (float)maxAmp.getMinAmp();
+        float dbPerLight = (float)(maxAmp.getMaxAmp() - maxAmp.getMinAmp()) / (float)juce::jmax(1, _nLights);
+        auto firstAbove = [&](float db) { return juce::jlimit(0, _nLights, (int)std::floor((db - mindb) / dbPerLight - 0.5f) + 1); };
+        int red = firstAbove(redLevel);
+        _orangeStart = juce::jmin(firstAbove(orangeLevel), red);
+        _redStart = red;
+    }
+
+    int LevelMeter::getZone(int l)
+    {
+        if (l >= _redStart.load()) return Red;
+        if (l >= _orangeStart.load()) return Orange;
+        return Green;
+    }
+
+    void LevelMeter::drawBackground(juce::Graphics& g)
+    {
+        int tx = getLightX();
+
+        drawClipped(g, tx, getClippedY(), _lightwidth, _clippedheight, false);
         for (int l = _nLights - 1; l >= 0; l--)
         {
-            drawLight(g, tx, y, _lightwidth, _lightheight, levels, l);
-            y += _lightheight + _spacing;
+            drawLight(g, tx, getLightY(l), _lightwidth, _lightheight, false, l);
         }
+        drawSignal(g, tx, getSignalY(), _lightwidth, _signalheight, false);
+    }
 
-        drawSignal(g, tx, _mTop + (_nLights * (_lightheight + _spacing)) + 6.0, _lightwidth, _signalheight, maxAmp.signal());
+    void LevelMeter::invalidateBackground()
+    {
+        // A finished frame has the old geometry or zones, so paint draws directly
+        // until a frame of the new generation is ready. No image is released here.
+        const juce::ScopedLock lock(_renderLock);
+        _backgroundDirty = true;
+        _generation++;
+        repaint();
+    }
 
-        maxAmp.clear();
-        return;
-    };
+    int LevelMeter::getLightX()
+    {
+        return _layoutWidth / 2 - _lightwidth / 2;
+    }
+
+    int LevelMeter::getLightY(int l)
+    {
+        int slot = _topDown ? l : _nLights - 1 - l;
+        return _mTop + slot * (_lightheight + _spacing);
+    }
+
+    // top down meters swap the indicators so clip sits at the far end of the travel
+    int LevelMeter::getClippedY()
+    {
+        int lightsBottom = _mTop + (_nLights * (_lightheight + _spacing));
+        return _topDown ? lightsBottom + 6 : _mTop - 6 - _clippedheight;
+    }
+
+    int LevelMeter::getSignalY()
+    {
+        int lightsBottom = _mTop + (_nLights * (_lightheight + _spacing));
+        return _topDown ? _mTop - 6 - _signalheight : lightsBottom + 6;
+    }
 
-    void LevelMeter::capture(juce::AudioBuffer<float> amps, int channel)
+    void LevelMeter::prepare(double sampleRate, int maxBlockSize, int nChannels)
+    {
+        maxAmp.prepare(sampleRate, maxBlockSize, nChannels);
+    }
+    void LevelMeter::capture(const juce::AudioBuffer<float>& amps, int channel)
     {
         maxAmp.capture(amps, channel);
     }
-    void LevelMeter::capture(juce::AudioBuffer<double> amps, int channel)
+    void LevelMeter::capture(const juce::AudioBuffer<double>& amps, int channel)
     {
         maxAmp.capture(amps, channel);
     }
@@ -180,31 +460,24 @@ namespace punch {
         _spacing = 2;
         _clippedheight = 16;
         _signalheight = 16;
-        _lightImages = juce::ImageFileFormat::loadFrom(LevelMeterBinaryData::APILights_png, LevelMeterBinaryData::APILights_pngSize);
+        _lightImages = juce::ImageCache::getFromMemory(LevelMeterBinaryData::APILights_png, LevelMeterBinaryData::APILights_pngSize); // decoded once per process
     };
 
+    UADLevelMeter::~UADLevelMeter()
+    {
+        setPreRender(false);
+    }
+
     void UADLevelMeter::setHeight(int height)
     {
+        const juce::ScopedLock lock(_renderLock);
         int topy = _mTop;
         int bottomy = height - _mBottom;
 
         _nLights = (int)((float)(bottomy - topy + 1) / (_lightheight + _spacing));
         maxAmp.setNLevels(_nLights);
-        auto mindb = (float)maxAmp.getMinAmp();
-        auto maxdb = (float)maxAmp.getMaxAmp();
-        float dbPerLight = ((maxdb - mindb) / (float)_nLights);
-
-        if (_lightImageIndexes != nullptr) delete _lightImageIndexes;
-        _lightImageIndexes = new int[_nLights];
-
-        for (int l = 0; l < _nLights; l++)
-        {
-            int thisImage = 2; // default to off, on = +3
-            float thisdb = mindb + ((float)l * dbPerLight);
-            if (thisdb > _redLevel - (dbPerLight * 0.5)) thisImage = 0;
-            else if (thisdb > _orangeLevel - (dbPerLight * 0.5)) thisImage = 1;
-            _lightImageIndexes[l] = thisImage;
-        }
+        updateZones(_orangeLevel, _redLevel);
+        invalidateBackground();
     }
     void UADLevelMeter::resized()
     {
@@ -223,35 +496,60 @@ namespace punch {
     void UADLevelMeter::setRedLevel(float level)
     {
         _redLevel = level;
+        updateZones(_orangeLevel, _redLevel);
+        invalidateBackground();
     }
     void UADLevelMeter::setOrangeLevel(float level)
     {
         _orangeLevel = level;
+        updateZones(_orangeLevel, _redLevel);
+        invalidateBackground();
     }
     void UADLevelMeter::clearClipped()
     {
         maxAmp.setClipped(false);
     }
-    void UADLevelMeter::drawLight(juce::Graphics& g, int x, int y, int width, int height, float* levels, int l)
+    void UADLevelMeter::prepareCaches(float scale)
     {
-        int index = _lightImageIndexes[l];
-        if (levels[l] == 1.0) index += 3;
+        // Frames are sliced out of the strip and resampled once per display scale,
+        // so drawing one is an unscaled copy.
+        if (scale == _framesScale) return;
+        int fw = juce::jmax(1, juce::roundToInt((float)_lightwidth * scale));
+        int fh = juce::jmax(1, juce::roundToInt((float)_lightheight * scale));
+        for (int i = 0; i < _nFrames; i++)
+        {
+            auto frame = _lightImages.getClippedImage({ 0, i * (_lightheight + _spacing), _lightwidth, _lightheight }).createCopy();
+            _frames[i] = frame.rescaled(fw, fh, juce::Graphics::highResamplingQuality);
+        }
+        _framesScale = scale;
+    }
 
-        g.drawImage(_lightImages, x, y, width, height, 0, index * (height + _spacing), width, height);
+    void UADLevelMeter::drawFrame(juce::Graphics& g, int index, int x, int y)
+    {
+        jassert(_framesScale > 0.0f); // prepareFrame builds the frames
+        g.drawImageTransformed(_frames[index], juce::AffineTransform::scale(1.0f / _framesScale).translated((float)x, (float)y));
     }
 
-    void UADLevelMeter::drawClipped(juce::Graphics& g, int x, int y, int width, int height, bool clipped)
+    void UADLevelMeter::drawLight(juce::Graphics& g, int x, int y, int, int, bool lit, int l)
+    {
+        int index = getZone(l); // frames 0-2 are red, orange, green off, +3 for on
+        if (lit) index += 3;
+
+        drawFrame(g, index, x, y);
+    }
+
+    void UADLevelMeter::drawClipped(juce::Graphics& g, int x, int y, int, int, bool clipped)
     {
         int index = 0;
         if (clipped) index = 3;
-        g.drawImage(_lightImages, x, y, width, height, 0, index * (height + _spacing), width, height);
+        drawFrame(g, index, x, y);
     }
 
-    void UADLevelMeter::drawSignal(juce::Graphics& g, int x, int y, int width, int height, bool signal)
+    void UADLevelMeter::drawSignal(juce::Graphics& g, int x, int y, int, int, bool signal)
     {
         int index = 2;
         if (signal) index = 5;
-        g.drawImage(_lightImages, x, y, width, height, 0, index * (height + _spacing), width, height);
+        drawFrame(g, index, x, y);
     }
 
     //---------------------------------------------------------------------------------------------------
@@ -267,26 +565,23 @@ namespace punch {
         _nLights = 10;
     };
 
-    void DrawnLEDLevelMeter::setHeight(int height)
+    DrawnLEDLevelMeter::~DrawnLEDLevelMeter()
     {
+        setPreRender(false);
+    }
 
+    void DrawnLEDLevelMeter::setHeight(int height)
+    {
+        const juce::ScopedLock lock(_renderLock);
         int topy = _mTop;
         int bottomy = height - _mBottom;
 
         _nLights = (int)((float)(bottomy - topy + 1) / (_lightheight + _spacing));
         maxAmp.setNLevels(_nLights);
 
-        if (_lightColors != nullptr) delete _lightColors;
-        _lightColors = new juce::Colour[_nLights];
-        int orangelight = (int)((float)_nLights * 0.66f);
-        for (int l = 0; l < _nLights; l++)
-        {
-            juce::Colour thiscolor = juce::Colour::fromRGB(0, 0, 0);
-            if (l == _nLights - 1) thiscolor = juce::Colour::fromRGB(255, 0, 0);
-            else if (l >= orangelight) thiscolor = juce::Colours::orange;
-            else thiscolor = juce::Colour::fromRGB(0, 255, 0);
-            _lightColors[l] = thiscolor;
-        }
+        _orangeStart = (int)((float)_nLights * 0.66f);
+        _redStart = _nLights - 1;
+        invalidateBackground();
     }
 
     void DrawnLEDLevelMeter::resized()
@@ -308,16 +603,22 @@ namespace punch {
         maxAmp.setClipped(false);
     }
 
-    void DrawnLEDLevelMeter::drawLight(juce::Graphics& g, int x, int y, int width, int height, float* levels, int l)
+    void DrawnLEDLevelMeter::drawLight(juce::Graphics& g, int x, int y, int width, int height, bool lit, int l)
     {
         g.setColour(juce::Colours::black); // off color
-        if (levels[l] == 1.0) g.setColour(_lightColors[l]);
+        if (lit) g.setColour(getZoneColour(l));
         g.fillRect(x, y, width, height);
 
         g.setColour(juce::Colours::grey); // border color
         g.drawRect(x, y, width, height, (int)_lightborder);
     }
 
+    void DrawnLEDLevelMeter::drawLitLights(juce::Graphics& g)
+    {
+        // the border is part of the cached background, only the inside lights up
+        fillLights(g, (int)_lightborder);
+    }
+
     void DrawnLEDLevelMeter::drawClipped(juce::Graphics& g, int x, int y, int width, int height, bool clipped)
     {
         g.setColour(juce::Colours::black); // off color
@@ -351,29 +652,21 @@ namespace punch {
         _nLights = 10;
     };
 
-    void SimpleBarLevelMeter::setHeight(int height)
+    SimpleBarLevelMeter::~SimpleBarLevelMeter()
     {
+        setPreRender(false);
+    }
 
+    void SimpleBarLevelMeter::setHeight(int height)
+    {
+        const juce::ScopedLock lock(_renderLock);
         int topy = _mTop;
         int bottomy = height - _mBottom;
 
         _nLights = (int)((float)(bottomy - topy + 1) / (_lightheight + _spacing));
         maxAmp.setNLevels(_nLights);
-        if (_lightColors != nullptr) delete _lightColors;
-        _lightColors = new juce::Colour[_nLights];
-        auto mindb = (float)maxAmp.getMinAmp();
-        auto maxdb = (float)maxAmp.getMaxAmp();
-        float dbPerLight = ((maxdb - mindb) / (float)_nLights);
-
-        for (int l = 0; l < _nLights; l++)
-        {
-            juce::Colour thiscolor = juce::Colour::fromRGB(0, 0, 0);
-            float thisdb = mindb + ((float)l * dbPerLight);
-            if (thisdb > _redLevel - (dbPerLight * 0.5)) thiscolor = juce::Colour::fromRGB(255, 0, 0);
-            else if (thisdb > _orangeLevel - (dbPerLight * 0.5))  thiscolor = juce::Colours::orange;
-            else thiscolor = juce::Colour::fromRGB(0, 255, 0);
-            _lightColors[l] = thiscolor;
-        }
+        updateZones(_orangeLevel, _redLevel);
+        invalidateBackground();
     }
 
     void SimpleBarLevelMeter::resized()
@@ -393,26 +686,35 @@ namespace punch {
     void SimpleBarLevelMeter::setRedLevel(float level)
     {
         _redLevel = level;
+        updateZones(_orangeLevel, _redLevel);
+        invalidateBackground();
     }
     void SimpleBarLevelMeter::setOrangeLevel(float level)
     {
         _orangeLevel = level;
+        updateZones(_orangeLevel, _redLevel);
+        invalidateBackground();
     }
     void SimpleBarLevelMeter::clearClipped()
     {
         maxAmp.setClipped(false);
     }
 
-    void SimpleBarLevelMeter::drawLight(juce::Graphics& g, int x, int y, int width, int height, float* levels, int l)
+    void SimpleBarLevelMeter::drawLight(juce::Graphics& g, int x, int y, int width, int height, bool lit, int l)
     {
-        g.setColour(offColour(_lightColors[l])); // off color
-        if (levels[l] == 1.0) g.setColour(_lightColors[l]);
+        g.setColour(offColour(getZoneColour(l))); // off color
+        if (lit) g.setColour(getZoneColour(l));
         g.fillRect(x, y, width, height);
 
         //g.setColour(juce::Colours::grey); // border color
         //g.drawRect(x, y, width, height, (int)_lightborder);
     }
 
+    void SimpleBarLevelMeter::drawLitLights(juce::Graphics& g)
+    {
+        fillLights(g, 0);
+    }
+
     void SimpleBarLevelMeter::drawClipped(juce::Graphics& g, int x, int y, int width, int height, bool clipped)
     {
         g.setColour(offColour(juce::Colours::red)); // off color
@@ -437,6 +739,259 @@ namespace punch {
     {
         return juce::Colour::fromFloatRGBA(onColour.getFloatRed() * 0.25f, onColour.getFloatGreen() * 0.25f, onColour.getFloatBlue() * 0.25f, 1.0f);
     }
+    //---------------------------------------------------------------------------------------------------
+    ContinuousBarLevelMeter::ContinuousBarLevelMeter(int marginTop, int marginBottom, float minAmp, float maxAmp, float incAmp) :
+        LevelMeter(marginTop, marginBottom, minAmp, maxAmp, incAmp)
+    {
+        _peakholdTimes = 10; // number of times to leave peak 
+        _lightheight = 1;
+        _lightwidth = 8;
+        _spacing = 0;
+        _clippedheight = 7;
+        _signalheight = 7;
+        _nLights = 10;
+        _map.setRange(minAmp, maxAmp);
+    };
+
+    ContinuousBarLevelMeter::~ContinuousBarLevelMeter()
+    {
+        setPreRender(false);
+    }
+
+    void ContinuousBarLevelMeter::setHeight(int height)
+    {
+        const juce::ScopedLock lock(_renderLock);
+        // One "light" per pixel row keeps the base class geometry and MaximumAmp in step,
+        // the bar itself is drawn from the dB level through _map.
+        int topy = _mTop;
+        int bottomy = height - _mBottom;
+
+        _nLights = juce::jmax(1, bottomy - topy);
+        maxAmp.setNLevels(_nLights);
+        _map.setPixels(topy + _nLights, topy);
+        invalidateBackground();
+    }
+
+    void ContinuousBarLevelMeter::resized()
+    {
+        auto area = getBounds();
+        setHeight(area.getHeight());
+    }
+
+    int ContinuousBarLevelMeter::getActualHeight()
+    {
+        return _mTop + _nLights + _mBottom;
+    }
+    int ContinuousBarLevelMeter::getActualWidth()
+    {
+        return _meterWidth;
+    }
+    void ContinuousBarLevelMeter::setRedLevel(float level)
+    {
+        const juce::ScopedLock lock(_renderLock);
+        _redLevel = level;
+        invalidateBackground();
+    }
+    void ContinuousBarLevelMeter::setOrangeLevel(float level)
+    {
+        const juce::ScopedLock lock(_renderLock);
+        _orangeLevel = level;
+        invalidateBackground();
+    }
+    void ContinuousBarLevelMeter::clearClipped()
+    {
+        maxAmp.setClipped(false);
+    }
+
+    juce::ColourGradient ContinuousBarLevelMeter::getZoneGradient(float brightness)
+    {
+        auto green = juce::Colour::fromRGB(0, 255, 0).withMultipliedBrightness(brightness);
+        auto orange = juce::Colours::orange.withMultipliedBrightness(brightness);
+        auto red = juce::Colour::fromRGB(255, 0, 0).withMultipliedBrightness(brightness);
+
+        float top = (float)_map.getMaxY();
+        float bottom = (float)_map.getMinY();
+        juce::ColourGradient gradient(green, 0.0f, bottom, red, 0.0f, top, false);
+        auto proportion = [&](float db) { return juce::jlimit(0.0, 1.0, (double)((bottom - _map.getY(db)) / juce::jmax(1.0f, bottom - top))); };
+        gradient.addColour(proportion(_orangeLevel) * 0.98, green);
+        gradient.addColour(proportion(_orangeLevel), orange);
+        gradient.addColour(proportion(_redLevel) * 0.98, orange);
+        gradient.addColour(proportion(_redLevel), red);
+        return gradient;
+    }
+
+    void ContinuousBarLevelMeter::drawBackground(juce::Graphics& g)
+    {
+        int tx = getLightX();
+        auto bar = juce::Rectangle<int>(tx, _map.getMaxY(), _lightwidth, _map.getMinY() - _map.getMaxY());
+
+        g.setGradientFill(getZoneGradient(0.25f));
+        g.fillRect(bar);
+        drawClipped(g, tx, getClippedY(), _lightwidth, _clippedheight, false);
+        drawSignal(g, tx, getSignalY(), _lightwidth, _signalheight, false);
+
+        // the lit bar is cached alongside the background, at the same scale
+        _litBarScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        int lw = juce::jmax(1, juce::roundToInt((float)_lightwidth * _litBarScale));
+        int lh = juce::jmax(1, juce::roundToInt((float)bar.getHeight() * _litBarScale));
+        if (_litBar.getWidth() != lw || _litBar.getHeight() != lh) _litBar = juce::Image(juce::Image::ARGB, lw, lh, true);
+        else _litBar.clear(_litBar.getBounds());
+        juce::Graphics lg(_litBar);
+        lg.addTransform(juce::AffineTransform::scale(_litBarScale).translated(-(float)bar.getX() * _litBarScale, -(float)bar.getY() * _litBarScale));
+        lg.setGradientFill(getZoneGradient(1.0f));
+        lg.fillRect(bar);
+    }
+
+    void ContinuousBarLevelMeter::drawLitLights(juce::Graphics& g)
+    {
+        if (!_litBar.isValid()) return;
+        int tx = getLightX();
+        int bottom = _map.getMinY();
+        int top = _map.getMaxY();
+        int levelY = _map.getYFromTable(_state.level);
+        auto place = juce::AffineTransform::scale(1.0f / _litBarScale).translated((float)tx, (float)top);
+
+        if (levelY < bottom)
+        {
+            juce::Graphics::ScopedSaveState save(g);
+            g.reduceClipRegion(tx, levelY, _lightwidth, bottom - levelY);
+            g.drawImageTransformed(_litBar, place);
+        }
+        int holdY = _map.getYFromTable(_state.holdLevel);
+        if (holdY < levelY - 1)
+        {
+            juce::Graphics::ScopedSaveState save(g);
+            g.reduceClipRegion(tx, holdY, _lightwidth, 2);
+            g.drawImageTransformed(_litBar, place);
+        }
+    }
+
+    juce::Rectangle<int> ContinuousBarLevelMeter::getSpan(int fromY, int toY)
+    {
+        return { getLightX(), juce::jmin(fromY, toY), _lightwidth, std::abs(toY - fromY) };
+    }
+
+    juce::Rectangle<int> ContinuousBarLevelMeter::getChangedLights()
+    {
+        int levelY = _map.getYFromTable(_state.level);
+        int shownLevelY = _map.getYFromTable(_shown.level);
+        int holdY = _map.getYFromTable(_state.holdLevel);
+        int shownHoldY = _map.getYFromTable(_shown.holdLevel);
+
+        juce::Rectangle<int> dirty;
+        if (levelY != shownLevelY) dirty = getSpan(levelY, shownLevelY);
+        if (holdY != shownHoldY) dirty = dirty.getUnion(getSpan(holdY, holdY + 2)).getUnion(getSpan(shownHoldY, shownHoldY + 2));
+        return dirty;
+    }
+
+    void ContinuousBarLevelMeter::drawLight(juce::Graphics&, int, int, int, int, bool, int)
+    {
+        // the bar is drawn in one piece by drawBackground and drawLitLights
+    }
+
+    void ContinuousBarLevelMeter::drawClipped(juce::Graphics& g, int x, int y, int width, int height, bool clipped)
+    {
+        g.setColour(_peakColor.withMultipliedBrightness(0.25f)); // off color
+        if (clipped) g.setColour(_peakColor);
+        g.fillRect(x, y, width, height);
+    }
+
+    void ContinuousBarLevelMeter::drawSignal(juce::Graphics& g, int x, int y, int width, int height, bool signal)
+    {
+        g.setColour(_signalColor.withMultipliedBrightness(0.25f)); // off color
+        if (signal) g.setColour(_signalColor);
+        g.fillRect(x, y, width, height);
+    }
+
+    //---------------------------------------------------------------------------------------------------
+    GainReductionLevelMeter::GainReductionLevelMeter(int marginTop, int marginBottom, float maxReduction) :
+        LevelMeter(marginTop, marginBottom, 0.0f, maxReduction, 1.0f)
+    {
+        _peakholdTimes = 10; // number of times to leave peak 
+        _lightheight = 2;
+        _lightwidth = 8;
+        _spacing = 1;
+        _clippedheight = 7;
+        _signalheight = 7;
+        _nLights = 10;
+        _topDown = true;
+    };
+
+    void GainReductionLevelMeter::init(int windowSize, int maxLatency)
+    {
+        _grAmp.init(windowSize, maxLatency);
+    }
+
+    void GainReductionLevelMeter::capture(CompareBuffer& buffer, int channel)
+    {
+        int nSamples = 0;
+        double reduction = _grAmp.capture(buffer, channel, &nSamples);
+        if (reduction > 0.0) maxAmp.captureDb(reduction);
+        maxAmp.advanceHold(nSamples);
+    }
+
+    void GainReductionLevelMeter::capture(const juce::AudioBuffer<float>& bamps, const juce::AudioBuffer<float>& aamps, int channel, int latency)
+    {
+        double reduction = _grAmp.capture(bamps.getReadPointer(channel), aamps.getReadPointer(channel), bamps.getNumSamples(), latency);
+        if (reduction > 0.0) maxAmp.captureDb(reduction);
+        maxAmp.advanceHold(bamps.getNumSamples());
+    }
+
+    GainReductionLevelMeter::~GainReductionLevelMeter()
+    {
+        setPreRender(false);
+    }
+
+    void GainReductionLevelMeter::setHeight(int height)
+    {
+        const juce::ScopedLock lock(_renderLock);
+        int topy = _mTop;
+        int bottomy = height - _mBottom;
+
+        _nLights = (int)((float)(bottomy - topy + 1) / (_lightheight + _spacing));
+        maxAmp.setNLevels(_nLights);
+        invalidateBackground();
+    }
+
+    void GainReductionLevelMeter::resized()
+    {
+        auto area = getBounds();
+        setHeight(area.getHeight());
+    }
+
+    int GainReductionLevelMeter::getActualHeight()
+    {
+        return _mTop + (_nLights * (_lightheight + _spacing)) + _mBottom;
+    }
+    int GainReductionLevelMeter::getActualWidth()
+    {
+        return _meterWidth;
+    }
+    void GainReductionLevelMeter::clearClipped()
+    {
+        maxAmp.setClipped(false);
+    }
+
+    void GainReductionLevelMeter::drawLight(juce::Graphics& g, int x, int y, int width, int height, bool lit, int)
+    {
+        g.setColour(_reductionColor.darker(2.0f)); // off color
+        if (lit) g.setColour(_reductionColor);
+        g.fillRect(x, y, width, height);
+    }
+
+    void GainReductionLevelMeter::drawClipped(juce::Graphics& g, int x, int y, int width, int height, bool clipped)
+    {
+        g.setColour(juce::Colours::red.darker(2.0f)); // off color
+        if (clipped) g.setColour(juce::Colours::red);
+        g.fillRect(x, y, width, height);
+    }
+
+    void GainReductionLevelMeter::drawSignal(juce::Graphics& g, int x, int y, int width, int height, bool signal)
+    {
+        g.setColour(_reductionColor.darker(2.0f)); // off color
+        if (signal) g.setColour(_reductionColor);
+        g.fillRect(x, y, width, height);
+    }
 
 #include <cstring>
 
@@ -446,281 +1001,54 @@ namespace punch {
         static const unsigned char temp_binary_data_2[] =
             "\x89PNG\r\n"
             "\x1a\n"
-            "\0\0\0\rIHDR\0\0\0\x10\0\0\0j\x08\x02\0\0\0:(F\x91\0\0\0\tpHYs\0\0\x0e\xc4\0\0\x0e\xc4\x01\x95+\x0e\x1b\0\0;\xa7iTXtXML:com.adobe.xmp\0\0\0\0\0<?xpacket begin=\"\xef\xbb\xbf\" id=\"W5M0MpCehiHzreSzNTczkc9d\"?>\n"
-            "<x:xmpmeta xmlns:x=\"adobe:ns:meta/\" x:xmptk=\"Adobe XMP Core 5.6-c067 79.157747, 2015/03/30-23:40:42        \">\n"
-            "   <rdf:RDF xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#\">\n"
-            "      <rdf:Description rdf:about=\"\"\n"
-            "            xmlns:xmp=\"http://ns.adobe.com/xap/1.0/\"\n"
-            "            xmlns:dc=\"http://purl.org/dc/elements/1.1/\"\n"
-            "            xmlns:photoshop=\"http://ns.adobe.com/photoshop/1.0/\"\n"
-            "            xmlns:xmpMM=\"http://ns.adobe.com/xap/1.0/mm/\"\n"
-            "            xmlns:stEvt=\"http://ns.adobe.com/xap/1.0/sType/ResourceEvent#\"\n"
-            "            xmlns:tiff=\"http://ns.adobe.com/tiff/1.0/\"\n"
-            "            xmlns:exif=\"http://ns.adobe.com/exif/1.0/\">\n"
-            "         <xmp:CreatorTool>Adobe Photoshop CC 2015 (Windows)</xmp:CreatorTool>\n"
-            "         <xmp:CreateDate>2022-12-06T17:20:23-06:00</xmp:CreateDate>\n"
-            "         <xmp:ModifyDate>2022-12-08T06:02:16-06:00</xmp:ModifyDate>\n"
-            "         <xmp:MetadataDate>2022-12-08T06:02:16-06:00</xmp:MetadataDate>\n"
-            "         <dc:format>image/png</dc:format>\n"
-            "         <photoshop:ColorMode>3</photoshop:ColorMode>\n"
-            "         <xmpMM:InstanceID>xmp.iid:5bd32bae-597d-e740-a775-1e0839763978</xmpMM:InstanceID>\n"
-            "         <xmpMM:DocumentID>adobe:docid:photoshop:33c95b82-75c1-11ed-b307-a76dc0d0d01e</xmpMM:DocumentID>\n"
-            "         <xmpMM:OriginalDocumentID>xmp.did:0399f88c-3e8a-9c48-89fb-a5c737ff9db8</xmpMM:OriginalDocumentID>\n"
-            "         <xmpMM:History>\n"
-            "            <rdf:Seq>\n"
-            "               <rdf:li rdf:parseType=\"Resource\">\n"
-            "                  <stEvt:action>created</stEvt:action>\n"
-            "                  <stEvt:instanceID>xmp.iid:0399f88c-3e8a-9c48-89fb-a5c737ff9db8</stEvt:instanceID>\n"
-            "                  <stEvt:when>2022-12-06T17:20:23-06:00</stEvt:when>\n"
-            "                  <stEvt:softwareAgent>Adobe Photoshop CC 2015 (Windows)</stEvt:softwareAgent>\n"
-            "               </rdf:li>\n"
-            "               <rdf:li rdf:parseType=\"Resource\">\n"
-            "                  <stEvt:action>saved</stEvt:action>\n"
-            "                  <stEvt:instanceID>xmp.iid:e079a042-256b-2842-ad4d-d822498328f6</stEvt:instanceID>\n"
-            "                  <stEvt:when>2022-12-06T17:54:13-06:00</stEvt:when>\n"
-            "                  <stEvt:softwareAgent>Adobe Photoshop CC 2015 (Windows)</stEvt:softwareAgent>\n"
-            "                  <stEvt:changed>/</stEvt:changed>\n"
-            "               </rdf:li>\n"
-            "               <rdf:li rdf:parseType=\"Resource\">\n"
-            "                  <stEvt:action>saved</stEvt:action>\n"
-            "                  <stEvt:instanceID>xmp.iid:5bd32bae-597d-e740-a775-1e0839763978</stEvt:instanceID>\n"
-            "                  <stEvt:when>2022-12-08T06:02:16-06:00</stEvt:when>\n"
-            "                  <stEvt:softwareAgent>Adobe Photoshop CC 2015 (Windows)</stEvt:softwareAgent>\n"
-            "                  <stEvt:changed>/</stEvt:changed>\n"
-            "               </rdf:li>\n"
-            "            </rdf:Seq>\n"
-            "         </xmpMM:History>\n"
-            "         <tiff:Orientation>1</tiff:Orientation>\n"
-            "         <tiff:XResolution>960000/10000</tiff:XResolution>\n"
-            "         <tiff:YResolution>960000/10000</tiff:YResolution>\n"
-            "         <tiff:ResolutionUnit>2</tiff:ResolutionUnit>\n"
-            "         <exif:ColorSpace>65535</exif:ColorSpace>\n"
-            "         <exif:PixelXDimension>16</exif:PixelXDimension>\n"
-            "         <exif:PixelYDimension>106</exif:PixelYDimension>\n"
-            "      </rdf:Description>\n"
-            "   </rdf:RDF>\n"
-            "</x:xmpmeta>\n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                                                                                                    \n"
-            "                            \n"
-            "<?xpacket end=\"w\"?>%\xea""F\x11\0\0\0 cHRM\0\0z%\0\0\x80\x83\0\0\xf9\xff\0\0\x80\xe9\0\0u0\0\0\xea`\0\0:\x98\0\0\x17o\x92_\xc5""F\0\0\x14ZIDATx\x01\0J\x14\xb5\xeb\x01""5=B\x01\x01\x02\0\0\xff\xfe\xff\xff\xff\xff\xff\x02\x01\x01\0\xff\0\0\x02\x01\x01"
-            "\0\0\xff\0\0\xff\xff\xff\x02\x01\0\xff\0\x02\0\xff\xff\xff\x01\0\0\0\xff\x02\x01\x02\x01\xff\0\xff\xfd\xfe\xfe\0\0\0\x03\x02\x02\xff\xff\xff\x01\x02\x01\0\xff\xff\xff\xff\xff\xfe\xfe\xfe\xff\xff\xff\xff\0\0\xff\xff\xfe\xff\xff\xff\x02\x01\x01\xff\xff"
-            "\0\x04\xff\xfe\0\xff\0\0\x02\x01\x01\x01\x02\x01\xfe\xff\0\x01\x01\x01\xf6\xf6\xf4\xf6\xf9\xf8\x02\x03\x03\t\x06\x07\x08\x08\n"
-            "\0\xff\0\x01\x01\0\x01\x01\0\0\xff\xff\xff\xff\xff\x04\xff\xff\0\0\x01\0\0\x01\x01\0\0\0\xf8\xf6\xf5\xe9\xe6\xe3\x10\0\xff\x16\xfc\xfc\xfb\xf5\xf6\xe7\xfe\xfd\xfd\x18\x19\x1c\x1a\x1d\x04\x04\x05\xfd\xfd\xfd\0\0\0\x03\x01\x02\x04\x01\x01\x01\x01\x02\0"
-            "\xff\xff\xff\xf9\xf7\xf7\xe7\xe2\xdeG  7\r\r\n"
-            "\xf5\xf4\xfd\xf4\xf4\xf1\xf6\xf7\xbf\xe9\xe9\xbe\xe9\xe9,03\x02\x03\x04\x01\0\0\x02\x01\0\x02\0\x01\0\xff\xff\0\xfd\xfc\xfc\xe4\xe5\xe2G  N\x19\x19\xfb\xe3\xe3\xef\xef\xef\xf5\x01\0\x0b\r\r^$%@\xff\xff\xda\xd7\xd3\x03\x03\x03\xfe\xff\xff\xff\0\x01\x02"
-            "\xfa\xfb\xf9\xfe\xfe\xff\xf9\xf9\xf9\x11\xfe\xfd""7\r\r\xe5\xd8\xd7\x01\x04\x03\x07\x07\x07\x04\x01\x01\xf8\xfd\xfc\xef\0\xffG\x1c\x1a\xf4\xef\xef\x0e\x0e\r\x01\x01\x01\xff\0\xff\x02\xfc\xfd\xfe\x01\x01\x01\xf7\xfb\xf9\x14\xfd\xfe\n"
-            "\xf5\xf5\xfd\0\0\x04\x05\x04\x03\x01\x01\x03\x01\x02\x05\x02\x01\xf7\xfd\xfc\x10\x08\t\x0f\0\0\x0c\x0f\x0c\x02\x01\x01\0\0\0\x02\x02\x01\x01\0\x01\xff\x03\x03\x02\xfb\xf6\xf5\xfd\xf4\xf3\x03\x06\x05\0\xff\xff\0\0\0\0\0\0\0\0\0\x01\0\0\xff\0\0\xfe\0\0"
-            "\0\xff\x01\xfe\xff\xff\x01\0\0\x02\x02\x01\x01\x01\0\0\x0b\x08\n"
-            "\xe7\xfc\xfc\xf1\xf6\xf7\x07\x02\x04\xfa\xfe\xff\xfd\xff\xfe\xfd\xff\xfe\xfb\xfe\xff\t\x03\x03\xea\xf6\xf6\xf3\0\0\xf9\xf7\xf9\x01\x01\x01\xff\xff\0\x02\x03\x04\x04\0\x01\x01\x05\x05\x06\xfe\x1a\x1b\xbe\xea\xea\x12\0\x01\t\x03\x04\xfb\xfe\xff\xfc\xfe"
-            "\xff\n"
-            "\x02\x03\x0b\x01\x02\xa9\xdd\xdd\x15\x1e\x1f\xf2\xf1\xf2\0\0\x01\xfe\xff\xff\x02\x03\x02\x02\x02\0\0\x02\x01\x02\x1c\x1a\x1d\xc2\0\0\x9f\xda\xd9\xf9\xf6\xf5\x11\x01\x02\x0f\x02\x02\xf1\xf7\xf6\x8d\xd0\xd0\xd2\x01\x01><@\xfb\xfb\xfb\xff\xfe\xfe\x01\x01"
-            "\x01\x01""5>C\x02\x01\x01\xff\0\0\xfe\xfe\xfe\x01\x01\0\xd8\xd1\xce\xf3\xf1\xf0\x11\0\0\xfd\0\0\xf2\0\0\x18!\":8;\xe2\xe4\xe6\0\0\0\xff\xfe\xff\x03\x03\x02\x01""6>C\0\0\0\x02\x02\x01\xfd\xfd\xff\x01\x01\x01\x02\x02\x01\x10\x12\x10\t\x0b\n"
-            "\0\xff\0\xfb\xf9\xfa\xeb\xec\xec\xfe\xfd\xfe\0\xff\0\xff\0\xff\x01\x01\x01\0\xff\0\x04\xfe\0\0\x02\x01\0\0\0\0\x01\x01\x01\xff\xff\xff\xfd\xff\xff\xee\xec\xef\xff\xec\xee\xff\0\0\x01\x01\0\0\xff\0\0\x01\0\x01\x02\x01\0\xfe\0\0\x01\x01\x01\0\0\x02\x01"
-            "\xff\0\x02\0\x01\xfd\xfe\xff\xff\0\xff\0\x01\0\x02\0\x01\0\x01\xff\0\0\0\x04\x02\x02\x02\0\x01\xff\xff\xff\x02\x01\x02\0\xfe\0\xff\0\0\0\xff\xff\xff\x01\0\x02\x02\x03\x01\xfe\0\xff\0\0\0\x02\x01\0\x01\x01\x01\xff\xff\xff\xff\xff\0\0\0\0\0\0\0\xfc\xfd"
-            "\xfe\0\0\0\0\0\0\xfe\xff\xfe\0\xff\0\xfe\xff\xff\0\0\0\x04\xfe\xfe\xfe\0\0\0\x02\x01\x01\0\x01\x02\xff\xfe\xfe\0\xff\xff\0\x01\x01\x02\x01\0\xfd\xfe\xfe\xff\0\0\x03\x02\x01\xff\xff\xff\x02\x02\x01\0\xff\0\0\x01\x02\xff\0\0\x02\xfe\xfe\xff\x02\x01\x02"
-            "\xff\0\x01\0\xff\xff\0\xff\0\x01\x02\x01\x02\0\0\xff\0\x01\xff\xff\xff\x05\x03\x03\x01\x01\x02\xff\xfe\xfe\x01\0\x01\xff\0\0\x01\0\0\0\xff\0\x02\x04\x03\x04\0\0\0\0\xff\xff\0\0\0\0\x01\xff\xff\xff\0\xff\x01\x01\0\0\0\x02\x02\x01\xff\0\xfe\xfe\xfe\xfe"
-            "\x02\x03\x03\0\x01\0\xff\0\xff\xff\0\0\x03\x01\x01\x04\xff\0\xff\xfe\xfe\xff\x03\x03\x02\xff\xfe\xff\0\0\x01\0\xff\xff\xf5\xf4\xf5\xf5\xf3\xfa\x03\x03\x03\x0b\x0b\x06\x08\x0b\x08\xff\0\xff\0\xff\0\0\xff\0\x01\x01\x01\0\x01\0\x03\x1a\x1f!\x01\0\xff\0\0"
-            "\0\xff\0\0\xf8\xf5\xf6\xe0\xdb\xdf\x13\x0e\xf7 \x1c\xea\n"
-            "\x04\xe0\xe9\xe7\xe8\xe9\xe8\x01\x0e\x0f\n"
-            "\x02\x02\x02\0\0\x01\x01\x01\xff\xfd\xfe\xfe\x04\x01\x01\x01\0\x01\0\xff\xff\0\xfa\xf8\xf8\xe0\xda\xd8""A?!1-\xfa\t\x06\xf4\xfa\xfa\xfd\xf0\xf2\xfc\xc9\xcd\xda\xc8\xc9\xe3""167\x01\x05\x03\0\0\x01\x01\0\0\x03\x1c!#\0\0\0\x01\0\0\xdf\xd9\xdc?<\x1cQG\xfc"
-            "\xeb\xeb\xd3\xfa\xf9\xf6\xff\xfe\0\r\x0b\0""80\0\xee\xf1\xfc\xd5\xd6\xf3\x19\x1b\x1b\xff\xff\xff\xff\0\0\x02\xfc\xfd\xfd\xff\0\0\xf7\xf6\xf8\x1f\x1d\x07""0,\xf9\xdb\xde\xd2\x03\x02\0\x06\x06\x01\x03\x04\x01\xf8\xf8\x01\xee\xf2\0:7\0\xf7\xf4\xed\r\x0c"
-            "\x0f\xfe\xff\xff\x01\x01\x01\x02\x03\x02\x02\x02\x01\x01\xf4\xf2\xf7\x19\x16\xf3\n"
-            "\x07\xe6\0\0\0\x04\x04\x01\x03\x02\0\x04\x02\0\x04\x04\0\xf7\xf7\0\x15\x12\0\x1b\x18\0\t\t\r\0\0\0\xff\xfe\xfe\x04\xfd\xfe\xfe\x03\x03\x03\x02\x03\x04\xf6\xf5\xee\xfb\xfa\xfe\x03\x02\0\0\xff\0\0\0\0\0\0\0\0\0\0\0\x01\0\xfe\xfe\0\xfd\xfe\0\0\xfe\xff\0"
-            "\0\0\x02\x02\x02\x02\xfb\xfb\xfb\x01\x01\x01\x0c\r\x08\xdf\xe2\x02\xef\xf1\xff\x07\x07\0\xfb\xfc\0\xfc\xfd\0\xfc\xfd\0\xfc\xfc\0\t\t\0\xe7\xea\0\xe5\xe8\0\xfa\xfc\xf7\x03\x02\x02\x02\x01\x02\x02\x07\x06\x06\xfd\xfd\xfd\x05\x07\x04\xf6\xf9\"\xc9\xce\0"
-            "\x13\x0f\0\t\t\xff\xfc\xfc\xff\xfc\xfd\xff\n"
-            "\n"
-            "\xff\t\x07\0\xbd\xc1\0\x11\x14\"\xf4\xf6\xf3\xff\xff\xfe\xfb\xfd\xfc\x03\x1c!$\xff\xff\xff\x02\x02\x03\x11\x13\r\xcc\xcb\xe8\xee\xf0\xfc\x16\x15\0\x11\x0f\0\x05\x04\0\xe9\xee\0\xad\xb3\0\xd5\xd8\x01LRQ\xee\xee\xee\xfe\xfe\xff\x02\x01\x01\x01""5@E\xff"
-            "\xfe\xfe\x03\x02\x02\0\0\0\xfe\xfd\xfd\xd8\xd2\xd1\xf3\xf1\xed \x1c\0\xfc\xfc\0\xe4\xe8\0\x14\x16%@E<\xe2\xe5\xe5\xfe\xfe\xfd\x01\0\x01\x02\x02\x01\x01""6@E\x01\x01\0\x02\x01\x02\xfb\xfb\xfb\x02\x02\x02\x02\x02\x02\x10\x0e\x11\t\t\r\xff\xfe\0\xf9\xfb"
-            "\xf5\xf1\xf1\xee\xfe\xff\0\xfd\xfe\xfd\x01\x01\x01\xff\xff\0\x03\x01\0\x04\x01\0\0\xff\xfe\xff\xfc\xff\xfc\x02\x03\x03\x01\x01\x01\xff\xff\xff\xed\xf0\xec\0\xf0\xed\xff\0\0\x02\0\0\0\0\0\xfe\xff\xff\0\0\0\x01\x01\x01\x01\x01\0\xfe\0\0\x02\x02\x01\x01"
-            "\xff\xff\xff\0\0\0\x03\x02\x02\xff\xfe\xfe\xfd\xfe\xfe\0\0\x01\x02\x01\x01\x03\x01\x01\xff\xff\xff\xff\xff\xff\x05\x03\x04\x02\x01\x02\xff\xff\xff\0\xff\xff\0\xff\xff\x02\xfe\xff\xff\x01\0\x01\x02\x02\x02\xfe\xfd\xfe\xfe\xfe\xfe\x02\x02\x02\x02\x01\x01"
-            "\x01\x01\x02\xff\xff\xff\0\0\0\x02\x03\x03\0\0\xff\0\0\xff\x02\x01\x01\x02\x02\x02\0\x01\x01\x02\0\xff\0\x01\x02\x01\x01\x01\x01\xff\0\0\x03\x03\x03\x01\xff\xff\xff\xff\xff\0\xff\xff\xfe\xff\xff\x03\x02\x02\xff\xff\xff\xfb\xfd\xfd\0\0\0\x01\x01\x01\xff"
-            "\xfe\xfe\xff\xff\xff\x02\x02\x02\x01\0\0\0\xfd\xfd\xfd\x01\x01\0\x02\x01\x01\xff\0\0\xff\0\0\xfe\xff\xfe\x02\x01\x01\xff\xff\xff\0\xff\xff\x03\x02\x02\x01\x02\x02\xfe\xff\xff\xfc\xfe\xfe\xfe\xfe\xfe\x04\xfe\0\0\0\0\x01\x03\x02\x02\x01\0\0\xff\xff\0\xfe"
-            "\xff\xff\x03\x02\x01\x01\x01\x02\xff\xff\xff\0\0\0\x01\0\0\x01\x01\x01\xfd\xfe\xfe\x02\x01\x01\x02\x02\x02\x02\x01\x01\x04\xff\xfe\xfe\x01\0\0\x02\x03\x03\xff\xff\0\xff\xfe\xfd\x03\x02\x02\xf7\xf3\xf2\xfa\xf6\xf7\x03\x03\x04\x08\x0b\n"
-            "\x06\n"
-            "\n"
-            "\0\0\0\x02\x01\x01\xfe\xff\xff\x02\x01\0\x02\x01\x01\x04\0\xff\xff\0\x01\x01\xff\xff\xff\xfe\xff\xff\xf9\xf7\xf7\xe9\xe1\xdf\x08\x10\t\xff\x0f\x03\xf2\xf7\xf5\xf9\xe0\xf4\x13\x03\x11\x18\"!\x02\x04\x04\x02\0\x01\0\0\0\xfb\xfe\xfe\x04\x01\x01\x02\0\0\0"
-            "\xff\0\0\xf9\xf7\xf6\xe8\xdf\xda""4K>\x12""0\x1c\xef\x02\xf5\xf0\xf9\xf4\xf5\xf1\xf4\xe3\xc3\xd7\xd4\xc7\xc8,67\x02\x04\x05\xfe\xff\xff\0\xff\xff\x03\x1a\x1e!\xfe\0\0\x01\xff\xff\xe4\xdb\xd9""4K<\x1fG-\xd0\xe5\xd7\xf5\xf8\xf5\x03\xfe\x01\t\t\t\x19""3"
-            " \xed\xef\xef\xeb\xd2\xdf\x18\x1d\x1f\xfe\xfe\xfe\x04\x02\x02\x02\0\0\x01\x02\x01\0\xf7\xf5\xf5\t\x11\n"
-            "\x12""0\x1c\xcb\xd9\xcf\x05\x05\x05\x0b\n"
-            "\n"
-            "\x03\x06\x03\xfb\xfc\xfb\xfd\xf3\xfb\"C,\xf1\xf2\xf0\x10\r\x0c\x02\x01\x01\0\x01\x01\x02\x02\x03\x01\x02\x02\x03\xfa\xf6\xf5\xff\x0f\x05\xef\x02\xf6\0\0\0\x07\x06\x06\0\x03\x03\x01\x04\x04\x04\x05\x03\xfc\xf9\xfa\n"
-            "\x10\x0c\0\n"
-            "\0\x0c\x08\n"
-            "\xfe\xff\xfe\xfd\xfe\xfe\x02\xf8\xfa\xfa\xff\xff\xff\x03\x03\x05\xf3\xf8\xf4\xf1\xf8\xf3\x07\x04\x05\xff\xff\xff\0\0\0\0\0\0\0\0\0\0\x01\x01\0\xfe\0\0\xfe\0\0\0\xff\0\0\x01\x01\0\0\x02\x01\xff\xff\x01\x01\0\x08\x0b\n"
-            "\xf8\xea\xf3\xf5\xf2\xf4\x04\x06\x05\xfc\xfa\xfc\xff\xfc\xfc\xff\xfc\xfc\xfd\xfb\xfd\x04\x08\x05\xf5\xea\xf1\0\xf8\0\xf8\xfa\xfa\x02\0\x01\x01\x02\x02\x02\x04\x05\x05\xfe\xff\xff\x06\n"
-            "\n"
-            "\x15\x04\x12\xe2\xc3\xd8\x02\r\x07\x05\x06\x05\xfc\xf9\xfc\xfd\xfa\xfd\x04\x06\x05\x02\x06\x04\xd1\xaf\xc6\x1b\x18\x1c\xef\xf4\xf3\xfe\0\xff\xff\xfe\xff\x02\x04\x03\x03\x02\x01\x01\xff\x01\0\x19#\"\xf8\xc9\xe7\xd1\xa6\xc3\xf6\xf5\xf6\x05\r\x07\x03\x0b"
-            "\x06\xf6\xee\xf3\xc1\x94\xb2\xfc\xda\xf0<DF\xfb\xfb\xfc\xff\xff\xff\x02\x02\x01\x01""7@E\x01\x02\x02\xfe\xfe\xfe\x03\x03\x02\x01\xfe\xff\xd3\xcf\xcb\xf3\xf0\xef\0\x0c\0\0\xfd\0\0\xf7\0\x1e\x1b 7@?\xe4\xe8\xea\x01\0\0\xfb\xfc\xfc\x03\x01\0\x01""7@E\0\0"
-            "\0\x01\x01\x01\x01\x01\x01\xff\xff\xff\xff\0\0\x15\x11\x10\x0c\x07\t\x01\x01\0\xf7\xfa\xfb\xea\xed\xed\xff\0\0\xff\xff\xff\xff\xff\xff\x02\x03\x03\xfd\xfd\xfe\x04\xff\0\0\x01\0\0\x01\x01\x01\xff\xff\xff\xff\0\0\0\xff\xff\xe8\xec\xee\x05\x04\x03\xff\xff"
-            "\xff\xff\0\0\x01\x01\0\x01\0\x01\xff\xff\xff\0\x01\x01\xfe\xfe\xfe\x01\x01\0\x02\x01\0\x01\x02\x02\x02\xfe\xfe\xfe\xff\xff\xfe\0\xff\xff\xfe\xff\xff\x04\x03\x02\xff\0\0\xfd\xfe\xfe\0\xff\xff\xff\xff\0\xfe\xff\xfe\0\x01\0\x01\0\0\xff\xff\xff\0\0\0\x04"
-            "\x01\0\xff\xfe\xfd\xff\0\x01\0\x02\x02\x03\0\xff\xff\0\0\0\x01\0\0\xfd\xfe\xfe\0\0\0\xfe\xfe\xff\x01\x02\0\x01\xff\0\x01\x02\x01\xff\x01\xff\0\xff\xff\xfe\xff\0\x04\0\0\0\0\x01\0\x03\x02\x02\0\0\0\xfc\xff\xff\x02\0\0\xfe\xff\xff\x02\x02\x02\xff\xff\xff"
-            "\0\xff\0\x02\x02\x01\x01\0\x01\xff\xff\xfe\xfe\xff\0\x01\x01\x01\x03\x01\x01\x04\xfd\xfd\xfd\x01\x01\x02\xfd\xfe\xfc\0\xff\xff\x03\xff\xff\x06\x01\x01\x03\xff\0\x01\x03\xfe\x01\0\0\xfe\xff\0\xfc\xfd\xff\xfe\x01\0\xfc\0\x02\0\xff\xff\xfd\x01\0\xfd\0\xff"
-            "\x04\x01\x02\x01\x01\xff\xff\x02\xfe\xfe\x06\x02\x01\n"
-            "\x01\x02\x04\xfe\xfe\x06\x03\x02\x02\xff\0\0\0\0\xfc\xff\xff\xfc\xff\xff\xfc\x01\x01\xf6\0\xfe\xfb\xff\0\xfe\x02\x02\xfb\xfe\xff\x04\0\xfe\0\x03\0\0\x08\x01\x01\r\x01\x01\x04\0\0\x13\0\xff\x03\xfd\xfb\x07\xfe\xfd\x01\x01\x02\xf9\0\0\xfc\x03\x05\xed\0"
-            "\x01\x06\0\xff\xf4\x02\x01\xf9\xff\xff\xfb\xff\xff\x04\x01\xff\0\x05\x02\0\x0c\0\x01\r\0\xff\x0b\xfb\xfa\xf8\xf2\xf1""1\xef\xee \xf6\xf6\0\0\0\xdf\t\t\xd2\x14\x15\x1a\x10\x11\xed\x01\x03\xff\xfd\xfe\xfc\x01\0\x05\x01\x02\x04\x04\x01\x01\n"
-            "\x01\0\x07\xff\xfe\x0c\xfb\xfb\xf6\xea\xe7\x7f\xe8\xe9\"\xf4\xf4\0\0\0\0\0\0\0\xef\xef\xda\xf0\xf0\x84\x19\x1a\x13\x1a\x1d\xf7\x02\x01\n"
-            "\xff\0\xfe\x01\0\x02\x04\x01\0\x05\xff\xff\x0f\xfe\xfd\xf6\xf3\xf1\x87\xe7\xe8\"\xf4\xf4\0\x02\x02\0\x0c\x0c\0\x0c\x0c\0\x02\x02&\xf6\xf6\x83\xe6\xe5\xf7\xf4\xef\x14\x01\0\x04\0\0\x02\0\x01\x02\xfc\xfc\xf9\x03\xff\0\x04\xfd\xfe""4\xef\xee\x1a\xf5\xf5"
-            "\0\x02\x02\0\x12\x12\0\r\r\0\r\r\0\x12\x12\0\x02\x02\x1f\xf7\xf7,\xea\xeb\x08\xfe\xfd\x03\x01\0\x03\0\xff\x02\xff\xfd\xff\x03\x01\x01\x08\x01\xff \xf4\xf4\0\0\0\0\n"
-            "\n"
-            "\0\x05\x05\0\x02\x02\0\x02\x02\0\x05\x05\0\n"
-            "\n"
-            "\0\0\0\x1f\xf5\xf5\n"
-            "\x01\x01\x03\x01\x01\x02\0\0\x02\x02\x01\x01\0\x01\xff\0\x01\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xfe\xfe\x01\x03\x03\x01\xff\0\0\0\xff\x02\0\0\0\xfe\0\0\xfc\x02\x02\xdf\x0b\x0b\0\0\0\0\xf6\xf6\0\xfb\xfb\0\xfe\xfe\0\xfe\xfe\0\xfb"
-            "\xfb\0\xf6\xf6\0\0\0\xe2\n"
-            "\n"
-            "\xfb\x03\x04\xff\x02\x01\xfd\xff\x01\x02\0\x04\x04\xfc\0\0\xf9\x02\x04\xd0\x13\x13\xe2\t\t\0\xfe\xfe\0\xee\xee\0\xf3\xf3\0\xf3\xf3\0\xee\xee\0\xfe\xfe\xdd\x02\x02\xdb!\"\xf9\x02\x03\xfb\xfe\xff\xfc\xff\xff\x02\xff\x02\x02\xfd\0\0\xf0\x01\x02\n"
-            "\x0f\x11|\x1a\x1b\xd9\n"
-            "\n"
-            "\0\xfe\xfe\0\xf4\xf4\0\xf4\xf4\0\xfe\xfe\xd5\x04\x04\x89&'\x0c\x14\x16\xea\xfb\xfc\xf9\xfe\xff\xfd\x01\x01\x04\xfd\0\0\xf7\x01\x01\x04\xff\xfe\xec\x01\x03\x15\x1a\x1c\x8d\r\r)\xeb\xea\x1f\xf6\xf6\0\xfe\xfe\xe2\t\t\xdd\"#\x14\x14\x15\xe1\xf3\xf5\xf7\xfc"
-            "\xfd\xf7\0\0\xff\x01\x01\x04\xff\0\0\xfa\xfe\xff\xf6\x02\0\0\xfe\0\xe7\x02\x04\x17\x11\x14\xe0\x0e\x0f\xe8\0\0\x02\x03\x03\xfa\x04\x05\x02\x02\x02\xdc\xf2\xf4\xf9\xfc\xfe\xf5\x01\0\xfd\x02\x01\xfd\xff\xff\x04\xfd\0\0\x01\x01\0\xf8\0\x01\xfc\x02\x01\x08"
-            "\xfe\xfe\xe5\x01\x01\x03\x01\x04\0\0\xff\x01\xff\x01\x01\xfb\xfc\xfa\xfe\xff\xfa\x01\0\xf9\x04\x02\xfa\xfe\xff\xfc\x01\x01\0\0\0\x04\x01\xff\0\0\x01\x01\xf9\xfe\xff\xfb\0\0\xfa\x01\x01\x05\xfe\x01\x03\0\xff\0\0\xff\x03\0\x01\xfd\xff\xff\xfb\xfe\xff\xff"
-            "\x04\x03\xfc\xfe\xff\xfc\0\0\0\xff\xff\0\x01\x01\x04\x02\x04\x03\0\xff\0\x04\x03\x01\xfd\xff\xff\xfc\0\0\xfd\x01\x01\xff\xff\xff\0\0\xff\x01\0\x01\0\0\0\x02\x05\x03\xfe\xfe\xfd\0\x03\x01\x03\xff\0\x01\x01\x01\xff\xff\xff\x02\0\0\0\x01\x02\x01\xff\0\0"
-            "\x01\0\0\x02\x01\x01\0\xff\xff\x01\x01\x01\x03\x02\x03\0\0\xff\0\x01\x01\xfe\xff\xfe\0\0\0\x01\x02\x01\0\0\0\0\0\0\x01\x02\x02\x04\x02\0\0\xfe\xfe\xfe\xff\xff\xff\x03\x03\x02\x05\x03\0\xff\x01\x01\x01\x01\0\x02\x01\0\0\0\x03\0\xff\xff\xfd\xff\0\xff\xfe"
-            "\0\xfd\xff\0\xff\x01\0\xfb\xfc\xfb\0\0\0\x04\xfe\0\0\x02\x01\x01\x03\x04\x02\x06\x03\x01\x05\x06\x03\xfe\x01\xfd\x03\x02\x02\x02\x02\x02\xff\xff\xff\xff\xff\0\0\0\xff\xff\xfe\x01\xf6\xf8\xfb\xfe\x01\x01\0\0\x02\0\xff\x01\x04\0\xff\xff\x02\x03\x01\x04"
-            "\x03\x01\x06\x08\x01\xff\0\xff\x15\x0e\x06\x04\x02\x01\x02\0\x03\x01\x02\x01\xfe\xff\xfd\xfc\xff\xff\xeb\xf1\xfa\x0e\x0c\x04\xf6\xf7\xfd\0\0\x02\xff\xfe\x01\x04\x01\0\xff\x05\x03\x02\t\t\x03\x04\x04\xff\x0f\t\x02\xed\xe8\xed""31\xe5\" \xef\xff\0\x01\xdd"
-            "\xdd\x0f\xd2\xd6\x1d\x1b\x1b\x15\xe9\xee\xf9\n"
-            "\t\x04\xff\xfe\xfd\xf6\xfd\xfd\x04\x04\x04\x02\x05\x06\x02\x01\x02\x01\x0e\n"
-            "\x01\xea\xe2\xe0\x8d\x8e\xe6,1\xee\0\0\0\0\0\0\0\0\xf0\xd0\xca\xeduu\x1e\x1e&)\xe7\xed\xf9\x06\x06\x01\xf9\xfc\xff\x03\x1e\"#\x05\x06\x02\x12\x0e\x05\xed\xe6\xee\x97\x91\xdc'/\xf0\0\0!\0\0""0\0\0 \0\0\x01\x18\x1b\xea""5-\xf3\xb3\xb5\x13\x0c\x10\t\xf9"
-            "\xfb\xfe\0\xfe\x01\x04\x03\x02\x01\x02\x02\x01\x04\xff\x01""83\xe6\",\xf1\0\0\x1e\0\0;\0\0\x07\0\0\0\0\0\x1c\0\0\xfe)4\xe1,'\xde\xe7\xf2""4\xf0\0\xfc\x02\x02\x01\x02\x02\x03\x01\x03\x02\x03\x03\x02\x03! \xee\0\0\0\0\0\"\0\0\x07\0\0\0\0\0\0\0\0\x07\0\0"
-            "!\0\0\0\"!\xf0\t\x04\x07\xfe\xfe\xfe\0\0\xff\x02\xf9\xfa\xfb\xff\xff\xff\x02\x01\0\0\xff\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xfe\0\x02\x03\x01\x02\x02\0\0\xff\x02\0\xfe\xfe\0\0\0\xfc\0\xfe\xdc\xde\x0f\0\0\0\0\0\xdf\0\0\xf9\0\0\0"
-            "\0\0\0\0\0\xf9\0\0\xdf\0\0\0\xdf\xe0\x10\xfd\xff\xfe\x04\x01\x02\xff\0\x02\x04\x01\x04\x05\xfe\xff\xfe\xfc\0\0\xce\xd3\x1e\xd8\xce\xeb(2\xe1\0\0\x02\0\0\x1e\0\0\0\0\0\xe2\0\0\xe1\xd2\xc8\x01\xdb\xe0.\n"
-            "\x12\xfd\xfc\xff\xfc\xfd\xfd\xff\x02\x02\0\x01\0\xfe\x01\xef\xf2\xfc\x16\x1c\x15mp!\xce\xc9\x0b\0\0\xdf\0\0\xc1\0\0\xc1\0\0\xdf\xca\xc3\x03{}/\x19\x1f\x1a\xeb\xee\xf6\xfc\xfb\xfe\0\xff\xff\x01""9BF\x08\x07\x04\t\t\x01\x01\x02\x01\x19\x13\x08\xec\xe6\xeb"
-            "'%\xdf# \xf1\xff\0\xfd\xe0\xe1\x10\xdf\xe1-\x17 \x1b\xe0\xe2\xeb\xf8\xf8\xfb\xf7\xf8\xfe\xfc\xfc\xfe\x04\xff\xff\0\xfa\xfb\xfd\xff\0\x01\x0b\n"
-            "\x05\xe3\xe9\xf7\x15\x14\x13\xec\xf3\x14\xf3\xd8\x05\x02\x02\x05\xfc\xfe\xfe\t\x12\xfc\xdb\xdf\xe9\0\xfc\xfe\xf9\xf9\xfd\xff\0\x03\xfd\xfe\xff\x04\xfe\xff\xff\x01\xfd\xff\xfd\x02\x04\xf5\xf4\xfb\x07\x08\x03\xed\xf0\xf9\xfc\xfd\xff\x04\x03\xf9\0\0\x01"
-            "\x01\x02\0\xff\xff\xfe\xfe\xfc\0\xf9\xf9\xfd\xfb\xfd\x01\xfe\xfd\xfc\0\0\0\x04\x01\0\x01\0\x01\x01\xfb\xfb\xfd\xfc\x01\xff\xfc\xfd\xfe\0\x02\x01\x05\x03\x02\xfe\xfd\xfe\xfc\xfd\xfd\x01\xff\0\xfe\x01\x01\xfe\xfd\xfe\xfd\xfe\0\0\xfe\x01\xfd\xfe\xff\x01"
-            "\x01\x01\x04\x01\x02\x01\0\x01\x01\x01\0\x01\x03\x03\x03\xfe\xff\xff\xfd\xfb\xfd\xfd\xfc\xff\0\x01\xff\x02\x01\x03\xff\0\xfe\xff\xfe\xff\0\0\x01\x01\0\0\xff\x01\0\x04\x03\x03\x02\x02\x02\x04\x04\x03\x03\x01\0\0\xfe\xff\xff\xfd\xfd\xfc\xff\x01\x01\x03"
-            "\x03\x02\x01\0\0\xfe\xff\xff\0\0\xff\0\xff\0\x01\x01\x01\0\0\0\xff\xff\xff\x01\0\0\x01\x02\0\xfe\xfe\xfe\x04\xfe\xfe\xfe\xfe\xff\0\x03\x02\x01\x03\x04\x02\x03\x03\x02\xfd\0\xfe\x01\x03\x03\x04\x02\0\xff\xff\xff\xff\0\x01\0\xfd\xfe\xfe\xfd\xff\x01\xfe"
-            "\0\0\xfe\0\0\xff\0\xfe\xfe\xfd\x04\xfe\xff\xff\x03\x02\x01\0\x03\x01\x02\x05\x02\0\x05\x01\x06\x02\x03\x01\x01\x02\xfd\0\xfe\x02\0\0\xff\xff\x01\xff\xff\0\x04\x01\x02\xfd\xf9\xfe\xff\xfb\xfe\xfd\xfc\xfd\x02\x03\x03\x04\x02\x02\x02\x01\x03\x01\x04\x07"
-            "\x03\x02\x07\x02\xfe\xff\xff\x07\x11\x05\xff\xfd\xfc\x0b\x02\x02\0\x02\x01\xfc\xff\0\xfc\xff\x02\xfb\xf0\xfd\x02\n"
-            "\x02\xfc\xf7\xff\x01\0\x02\x01\xfe\x01\x04\x02\x02\x02\x01\x04\0\0\x06\x01\0\x05\0\x07\t\x01\xf1\xe5\xe2\xe7""0\xe3\xef$\xfb\x01\xff\0\x0f\xdb\x04\x1a\xd5\x1f\x12\x1d\x1f\xf6\xee\xfa\x04\x08\x02\xfd\xfe\0\xfd\xfa\xfe\x04\x01\x02\xff\0\x03\0\0\0\xff\x05"
-            "\t\x02\xe5\xe1\xd1\xe7\x8e\xf8\xed-$\0\0\x1a\0\0\0\xef\0\xe5\xed\xcf\xd9\x1et\xeb!'4\xf4\xe9\xf9\x03\x08\x02\0\xfe\0\x03\x1d$$\x04\x07\x04\x06\x11\x06\xf4\xe5\xe4\xdd\x94\xee\xef)7!\0N/\0""0 \0(\x02\0%\xe9\x19\xfd\xf5""3\xda\x13\xb2\x05\x08\x13\x0f\xff"
-            "\xfb\0\xff\xfd\xfe\x04\x04\x06\x03\x01\x01\x01\x03\xff\xfd\xe8""5\xe4\xf0%\"\x1e\0""E;\0\x1c\x07\0\x04\0\0\0\x1d\0\x0c\xfe\0""D\xe1,\xea\xe1)\xdc.\xf1\x1b\xfa\xfe\xfd\xfe\0\0\x02\0\0\xff\x01\x01\0\x06\x02\0\xee\"\xf9\0\0\x1c\"\0\x10\x07\0\x04\0\0\x03"
-            "\0\0\x03\x07\0\x04!\0\x10\0\0\x1b\xef#\xfa\x06\x06\x02\0\xff\xff\x02\x01\0\x02\xfd\xfd\xfd\0\0\0\0\x02\x01\0\0\0\0\0\xff\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff\xff\xff\x05\x01\x04\x01\0\x01\0\0\0\x02\xfd\xfd\xff\xfe\xfe\0\xfb\xfe\0\x10\xdb\x05"
-            "\0\0\xe5\xdf\0\xf0\xf9\0\xfc\0\0\xfd\0\0\xfd\xf9\0\xfc\xdf\0\xf0\0\0\xe4\x10\xde\x04\xfd\xfe\x02\x01\x03\x01\0\x01\x02\x04\x03\x01\x02\xff\0\xff\xfe\xfe\x02\x1c\xd1\x1f\xeb\xd6\xd9\xe1*\xbc\x02\0""D\x1e\0\x10\0\0\0\xe2\0\xf0\xe1\0\xbc\x04\xd0\xd2-\xdf"
-            "8\xf9\x12\xfd\xfd\xfd\xfd\xff\xfc\xfd\x04\0\xfe\0\x03\x01\x02\xfb\xf2\xfd\x0e\x1c\x1c n\xeb\xe2\x89\xc2\xdf""3\xe9\xdf\0\x1c\0\0\0\0\0\xe4\x06\xc8\xd2*\x85\x1b\x11*!\xe6\xde\xe9\xfe\xfd\xff\xfe\xfd\xff\x01<EJ\x02\x06\x02\x03\n"
-            "\x02\x01\x01\xff\x0c\x16\n"
-            "\xf0\xe6\xe2\xe2$\xde\xef$\xfb\xfe\xff\xfe\x10\xde\x04,\xe2""0\x14\x1d!\xe8\xe4\xec\xfb\xfb\xfc\xfd\xf6\xff\0\xfc\xff\x01<DI\0\x03\x01\x06\x08\x05\0\x06\xff\xff\xfd\x01\x07\x12\x04\x06\x06\x01\x07\x06\x04\x03\x01\x02\xfd\xfe\x02\xf8\xfb\xfd\xf6\xeb\xf5"
-            "\xff\x01\0\xfd\xf8\xfd\xfd\xfa\xff\xff\xfd\0\x04\xff\0\xff\x01\xfe\0\xfb\xfa\xfc\xff\xfa\xfe\x05\n"
-            "\x05\xfb\xf2\xfc\xfb\xfd\0\xf2\xff\xf9\x03\x02\x03\0\x01\xff\xfe\xff\xff\0\xfd\xff\xfe\xfb\xff\xfd\xfa\xfe\xfe\xfd\xfe\xff\xff\0\x04\xff\xff\0\xff\xff\xff\x01\xfb\xfd\0\x01\0\xfd\xf5\xfd\xfc\x02\xfe\0\x02\x02\0\0\xff\xfd\x01\xfd\0\xfe\0\xff\xff\xff\0"
-            "\xfd\0\xff\xfe\0\0\xff\0\x02\x01\x01\0\x01\x01\x01\0\0\xff\xff\xfc\x87\xf6\x8dp\xd9j0\0\0\0\0IEND\xae""B`\x82";
+            "\0\0\0\rIHDR\0\0\0\x10\0\0\0j\x08\x02\0\0\0:(F\x91\0\0\r\x14IDATx\xdauX[\x8f\x1c\xc7u>U]=\x97\x9e\x9d\x9d\xd9\x1b\xcd\xbd\xef,I\xd1\x14\x96\x16\x19R\xa2""b1\x12""c\x89\x16\x12\x07\x06\x9c\x1f\x90\x7f\x90 \x0f\xf1Sl\xf8!\t\x02?\xc8@\0\x03y\xcc[\x80<\x04"
+            "\x01l\xe4\xcdq \x0bHD+\xa1\xc8U$\xf1>\xbb\xcb\xbd\xcd\xee\xcemg\xbagz\xba\xab\xca\xdf\xa9\x9eu\xec\x07""7{9\xdd=U\xd5\xe7\xf2}\xdf""95\xe2\xf5?\xf8\x86\x10\x92\xc8\x1a\xcb\x87\x14\x82,\x11\x7f\xf0\xa7{\x82\x0b\xc9WxD\xb8\x95\xc2\x92\xd5\xc6\xe0\xce\x93"
+            "\x92\x9f\xf3\x10>\x8cq\x8b\xf0""4\x93\xad\x85\x1b""e\xcdxE\x8c""3\x96\xf0\x19""E\xfd(\x1eJ\xcf+\xe6\xf2\x85""B@\xfc\x90\xdc\x1b\xf9P\xbc\x02n\xf8\x01\r\xa3\xb0\xb1\xff\xb2J\xf6\\\x9a&at`\xb4>?\xbf\xb4\xb0\xac\x94\xaf\xb5""f\x13\x84T\x82\xd7\xe6\xc9\xf1"
+            "`p\xb0\xf3\xe2\xfd\xb5\xb5[\xe5r\x10\xf6u\xbf\xdf\x8d\x06\xff\xd9h\xfc\xbc\xd1\xd8\xb8vCzJ\xb0!\xf0\x86\r&\x9d\xa6\xbb{;\x18\xfd\xed\xf9\xf9\xe4\xe5\xcbv\xbb\x1d\n"
+            "*\x95\xcb\x7fv\xf1\xd2\x1dk\x9f|\xf9\x99\xe7y\xec\x07\t9Jb\xf8\x16\xc7\xf1\x94\xd1X{\xef\xd1\x97""By\xf9|\x1e\xaf\x1e\xea\xb4M\xf6\xfd\xa5\x85~\xbb=9Y\x86)\x08\x8fL\xb5\xc1\xd5 \x89g\xb5\t\xc2\x10\x96*_yB\xc0\\_\x8a\x81N\xab\x85""b\x85h\xa2""2\xe1""B"
+            "M\x92?\x84\xf5<\x99""D\xa1\xee\xf7\xbc\x9c\xcf&\x9e\x1dY68\xe4\x16""1\xe4L\xf0\x04|\x94\n"
+            "\xc1""A\x9a\xc2\xcb\xbcT#c\xb5""58\x13""c\x8b\x9ew\x14""E=\xa2x\x10\x0b\x97\x07x\xaf\x10S\xdf\xcf\x99\x85\xc5\x9f\x1f\x1dM\x93(z\n"
+            "CSc\x03\xe9\x95\x84\xfc\x97\xe7\xcf\xe7VVO\xbb\xa7x\x1f^\"\x91]\xc9\xf1\x92\x88\xf7/\x88\xfe\xe9\xc9\xe3""8\n"
+            "\xa7\x84\xacH\xd9\x1d""D\x1f<x\xb0)\xc4\xdb\xb7\xef$I\x82\xccs\x0e^\x7f\xfb]\xce""9\x0c\xe5{z\xf4\xf0~\xaf\xdb\x99\"\x82\xf7X\xf3|m\xfd\xebo\xbe\xb5\xb3\xbbO\x0empU\xbc\xf1\xf6\xbb\x99\xefZ[\xce\xa1\x14\xd5\xe9j\xb1\xc4\x88H\xe2\xd1\xf1\xc9\x89\xd1\x0c"
+            "\x1e\xfc\x13\x0e\x97\xca\xb8\xfcq@\xd8'\xb8k['m{\xd2\xb2\x19\\\x1cp\x18\x8e\xc6\x8d\xe0\xc1\x8c]\xa1\xe1\x0e\xa3\xcc""e\x9e\r$\xc5\xbe\t\x07RI\x0e\xa0\x19\xc2\xa5\xf4""Dv+\xc5\xf8%\xbfN\x03r\x9a]\x18\x07i\xe3\xbeP\xc6""1\xc1\xa5O\"\x0e\x9c""5F:\x81!\x96"
+            "\x19\xe2^\xe2H\xc4\x03""0\x12\xcf%_9\x0c""2\xb8\x1c\xfd\x9c""1\xbe\x07\x88\xf0*\x99\x95\x8ep$\x95\xa7\xc8\xd9\xe7\x1cg{\xec\x19""f,\x87\xda\x80I\xbc\x9a\x1b\x81\x05\x14\xae\x8c\x0b\xb0""5n\x15k\xc3~\x18\xf6""F\xc0s\xa9\x94+\x94\n"
+            ".\xa4\xee\xa5l6y\x0b\xab""5\x91\xc5\0\x8c\x0b\xa3\xad\xa7\xf5\x99\xc9\xc1\xda\xd2Q\xa0\xb6\x1a\x07\x87\x8d""C1Y\t\x1c\x18""8\"pLe\xf3\xf0\xbe\xd1p\xb8\xf5\xe4\xd1\x1f\xbeS\xbb~uT\xcc\xf5G#\xdd""9M\xef\xfd\xef\x93\x8f\xef\xbd\xbc\xfe\xc6-\xe1{Yb\xbc\xa5"
+            "\xda\x85\x0c\xc6\xf5\xc7\xcf\xde\xb9\xbd\xf4\x9d\xf7\xd3\xe3\xe3\xcf""Fq\x84H\x96K\xf4\xe6""5ju\xd3\xcf\xbf\xe8\xcd/.f\x01\x07\x81""4>\x06\xd1pu9\x7fm#~\xfa""b\xd3\x93\x94\xcb\tpx8\x14\xadS\xfa\xfa-\x1a\xf4\x9b\xe5\x89\n"
+            "\xf3\x01Qc\xb4\n"
+            "\xd1?\x1d\xcc\x9f\xeb\x05y\x06\x99R\x02s\x14NE\x83\x01\xcdM\xd3\xe2y*\x16\xcb\x0e\x7f""F\xc1\x0f\x04\x04\xb4\x88\xc2V22\x9e\xcb\x02\xfd\x06\xe5\x90L\xce\xb8qh\xc0\x01\xa0\xe3""E\x13\xe5""B}G\xb6\xbb""6\x9f\xa7$\x05(\xdc\x99""ba:8\xa2\xbd""C\x1a\xa5\x03"
+            "g\x8b\x94\xf9\\\x0e\"\xe5\xe7U\x14\xaf\xdf\xbbO3\x15\x0c\xb2ijSm\x83\xc0\x16\xf3\xf4\x1f\x1f\xd2\xd4\xecz?\xea""A0\x13\x9d\"J\x17\x1dZ\xbc\xa9\x99\xf2\xff|r\xd8\xea\xa4\xe7\xe6h\xaa""B\xbe\xa2""F\x8b\xfe\xf5\xa7\xf4\xf9#\xf1'\x7f\xfa\x9dV\xab\xe5@\x04"
+            "\xc6\xdd\xb9\x0bW<N\rA\x1a\x1fm>\xecu\x9bkKl\xcf\xee!\xcd\x9e\xbbt\xe7\xee\xed\x9d\xbd=c4\xc3\x13""3\xde\xb8s\x17\xf9\x80qpF\xba\xa3:9\x85\x98 \x0fq\x12v\xbb-x\xab""1\xdaI\x86'\x88\x15\x13(\x82\xcd\x92\xb1\xc9\xe8kvN\xa8\xd3\xe4\x1c\x8d\xc9`3>\n"
+            "G;\xe9T\xdf\x8e\x8b\x03^\xcc\xf4\0\xc6\xa1|\x19\x99\0r\xc5\xf8\xb7\x0e\xaf\xf0\xd6\xe9\x19\x8c\x93<\x16`vy\x14\xd9\x08\xac\x07l;\xacJ\xd6\x07IN\xe9\xdd\x82Ni\x90\xc1""1G]\xcd\xc9\n"
+            "R\xe2*\x03\x0fp\x05\x89\x17\xc4=R\xe1\\\x17""6\x13Sk\xc6\xa6\xbaiX\x1c""cS\xb6\xc0(\xc7s\xe1\xb9y\xd6""1\xdd\x93\xffo\x92\xabM\xd0\x14\x93\x99$\x99qLY\xb6\x95\x97""3\x1a""3\x07\xbd\xd3Q4\xf0<U(\x05\xb9 \xc8$\xc2\xb8r\xca\x13""2\x99\xb0\xcehT\xad\xc6v"
+            "\xbdP-\xda\x8aw:\x08\xe3\xad\xfe\x8c""7u~\xbd&\x95\x92N\x03\x12\xc7""8\x99\xf1""3\x1e""D\x87\xf5'7\xbf\xf5\xf6\xf4\xb5\xa5\xb6\x0c;q?\xec\xf6_~\xf4\xe5\xff\xfd\xf7\xc7\x1bo\xdc\x92\xca""7\x99K\x0b+5\xe3\xe4""b\xf7\xe9\xe3\x9b\xdf\xba\xbd\xfa\xfe\xd5\x07"
+            "{_\x86\xc3\xd0""3\xa2X,\xce\xdfXk\xb6\xdb\xc7\x9b\xf5\xf3\xcb\xab\xecq\xc6n\x18""7\x08\xc3\xe2T\x80\xb5?y\xfc\xa9\xef\xfb\xa5 \xf0r^\x92&\xba\x97\xac\xbf\xbb\xd1=\xedT\xcb\xae""d\xb1\xeb\x1e\xff\x8d\xa2\xd0V\xfc\xb6\x8c`\x1e\0\x8f\x8c\x08\x85\xea\xec"
+            "\xa5\xf1(\xa8NP@\x13\x85\0\xb1\xe6p\rG#x\xecy~o\xd8\xef\x0e{y\xe5\xdb\xdf\xa8q\x94\x01\xc8""dn\x8e\xd5\x9b\x95\x0e\x11\x1c\x1e\xf5\xc2\xd3\xbe\xca\xf9\xe9(u\x0cJu\xa2U\xc1\x0f\x8f\xba""4$\xac\xeb\x80!\xe1=\xbb\x8fx\xcf\xa9\xe9\x9d\x8f\x1e\xc9r\xde\xc7"
+            "\x9c""8\xd5#\x8d\xc9""2\xa7\x1e\xfe\xdb\x7f-\x9e_j\xf7{\xc6\x01\x06\xda\xca\x99\x05\0\xe7/\xac\x0f\xef\x1d<\xfc\xe7\x8f\xa2""0\xf2\xcby\xaf\x94\x8bZ\xbd\x0f\x7f\xfc\x93\xf4I\xe7\xf6{\xdfL\x92""4\x93qq\x0b\x04\x02TX;\xb8\x9d\xf9\xec\xd3Oz\x9d""6M\xb8\""
+            "7\xa0\x95\xc5\xb5[w\xde\xd9=<\x82\xf5I\x9a\x82@<\xe1\x8c\x1f\"\xd3\xb6\xb9\xa9\xea""D\xbe\x08\xc7\x06\xa3\xe4\xa8\xd9\xb4\xe3\xbe\x07\x05\xd7\xd3\xda\xa8\xb3\xeeg<\x1a_\x1e\x9e\xb4\xd0<d\xb7Nx\x1dl\x01'Wf\xe5\x98=\x8c\xf5\xcc+\xab<\xae""4\xdaU#\x87_\xc3"
+            "\x93\xdc{X\x17\x05""c\xd4\x95""C\xe9\xd1\x19\xa4\xb3\x8e\x0e\x8b\x08.\x8c\x8c\x05+2V\x91\xca\xf4""0\x93\x19\x04""B:\xd6K\x99\x91\xf8\xacwa\xb2\xb1\xd9\\\x81\x1c\xd7\xa4""6)#\x11\t\xc1S|\xe7""1I0\x08\xfa\x87\xab\xd4u\x95\x10&MV\t\xc7""E8\x91\x93\"@K\x87"
+            "\x0b\xe6""2e/\xe4\x13m#\x99\x04\xce@\x88\x8dU\xc0\t\x84\xa1 D\x99\xd9""D3d=\x9d\xe4Y\xb9""d\x8c""9\x9e\xdf$\x91#\xdb\x97\"\x86  $p\xc6\x97H\x94(\x93-%\xa3\xe1i\xf7z\xbb\xb5\x16""1l\xeb\xc5\xe2\xe6\xec\xdc""Bu\xaa\t3a\xb4 \x1f&\x80r\x81\xa0\xbc""5\x13"
+            "I\x12\x1d\x1d\xfc\xe0\xb0\xb1\xde\xef\x8f\xa1\xdan?\xe9t\xfev~afay\0\x83""a\x15\x82\x89\xb8\x02\xd0\x15\xa3\xa3^\xf7\xef\x0f\x0ey4\"61\xc1\xa7\x94\xaf""D\xd1\xdf\xec\xef\r\xfa\xedY\xc1\x01""E\x90""e\x9a\xc6\x08\x0b\n"
+            "\xd1\xcdvk!\x0cy\xf4\xf4""4\x95\xcb|\xe2""B\xca\xd5\xc1`\xe3\xe8\xb8\0""AA\xf4!\x81hx\x10\xdd\x82\xb0k\x99%\xd0\x15\xdf\xe7i8q\xe1""df5\x0c\x03\x97\x04\xf9\xeb\xae""2k\xa5\x7f\xe7\x01\x14\xb1\x8a\xba\xee\x9e\x1c\x01S)\xeb\xa5\x12\x7f\x87\xf8$\tWB\x9c"
+            "\xb8p\xe1\xda\t\x82\xc4SP2\xcdXQ*\x85(I\xf5`ff\x07""5\x10\xe3Z-\xea\xf5\xf8\xc4\x85""1\xcf\xa5|Z[\x8f\xa5\xc7\xad&R\x0c\xdc\x80*\x1d!\x83\xca\xd4\xf7\x16\x16\x1f\xc3h\xcc\x81?8\x8d\xf9\\\xa9\x1f\xberyb\xf6\xdcQ\x92\xc6\xe8g\x19K \x96\x93\xd8\x13\xe1\xcd"
+            "-,}P._9>Z\x85%\xc6\xe0\x85\xcf\xd7/\xcc\xce\xcem\xf7\xc2""A\xaa\x07\xdc\x1es\xfb""Ch\x85#F)\x1dH\xf5\x95\xa9\xd9\xad\xc9\xca\xa1\x93\xe7\x91\xf2\x01\xdbg\xa7\xfd""85h\xf6""5\xfb`\xf9\r\x88\xd0\x90""D*E\xc1\x98=\x0e\x9f\xe2\xb5\xb0Z\x92""b\xad\x91\xa0"
+            "XI\\\xa4.\x92\xca""5g\x02\xf6%x\x15zj\x04\xd0\xd5(\xb4""aX/q\x0c""D[\x9d""f]\x1bL\x82\xcep\xfb\xea\xf1\xd7x\xaa\xc7""5\xd2:V\x92\xf4=\x14J\x94[\xcf\x8ey\xcfyp\x1b-\x12Yo\xe9z\x1c""4+Y\xd3\xc6\x84\xce\xe4:\x13N\x08\x9ft]\xb7\x93W,\xe7\x1a""f\x91\xf5\xca"
+            "Lq\xcd""e\x89\xf8\x7f\x01]J\\\xdf\xea\x16""F-\xcey\xc2\xcf\x81\x9a\\\xb5""2N\x8f""e\xc7\x88h\x98\x18'\xc4\x98\xc7%\x0b\x8a\x0f\x1fr\x05\x16\x86\xb9\xc9\x1c\xd7q\xde\x80\xc1\x1e\x8d\xd4\x1ewG\x93\x13*\x1a \x9c\xa8\xfc\x82""e\xc6\xf7""d\x11\xbb\x0c""e+"
+            "E\xd9<l\xde\xb8\xbe\xb7\xbe\xd6\x86\x07\xcf\x9fW6\xbfX^\\\x9ck\xb4\xe2\xa0\x88\xdc\xeaHk\x94\r\xe9\xe7x\x83""9\x19\x88\xa3\x9d\xad\x0f~\xb4\xbfq\xbdu\x86\xd2\xce\x83_6\xbf\xfb\xdd\x95\x95W\xae\x1c""4c4\x82qj\xbd\x95\xf5\x0b\x98""0=\xe9""7\xf7[\xff\xf8"
+            "\x0f\xcf.\xbf\xd6!\xaa\x11]#ZCT\xce/\x1e\xbd~\xb5\xf7\xd3\x7f\x9f\x99\xa8\x16\xe3\x04\x10\x86\xf1\\\xe7\x81\x10\xf1\xe6\x8d\xfd\xf5\x8d.\xd1\n"
+            "\xd1[\xa8[\xee\rK\x08\xe1\x95\x9b\xdb\x1b\x97_\x1c\x9c\xde\xec""0\t\\\x8d""C\xd4q\xd6\xd6""2K\xd6\xcf""F\x93\xbb\xa8\xf1\xa3Z\xa7\xa8\xf2n\x1f`e<J\xb2M\xf3o5\x93\xbf}\xb0N\xbb\xe2\xe9\x18\xe7t7%\xf3\xec""E\xc5}[\x07\x9d\xce""F\xc6\xee\x96\xea[UH\xa6\xe2"
+            "]\x03T\x86K<\x94\x95\xee\x7f\xb6\xf2\xe8\xfe\xf1W\x7fo\xdb\xb5""b+n\xc2\x0e\xd1\xf6\xe6\xc7\xe2\xe9\xd6\xd7\x82i\xcd\x9d\xa6\xb6\xdc""4\xc1\xf7\xf6izni\xee\xcf\xff\xb2v\xff^\xc9\xad\xfa\xa1;\xeb\xbf\xfc\xc8\xfb\xeb\xef\xbf""6\xbf\xbap\xdc\x8a\xd2\x84"
+            "+\x86\xf8\xfdo|\xb3\x90W\xc5\"\xef""c\xe6g\n"
+            "'\xfb\xc7\x97/\xd5/\xacu\xd1\x1anmW\xeb\xdbW\xbf\xb2\xb6\xb8\xb5s<\x1c&\x83\xa1IS\xc3;\xf6Q\xc2\x15\xa5\x14\xf8/\x1b\x83\xb9\xd9\x99\x93\xdel\xef\x11\xb8\xe6\xa3\xa3*N\xa7O\xeb\rJM\x1c""c\x8c\x87\xcd\x98\xe2\x9eO[-U\xd8O\xf2\x05\xaf\xd9""A\x89\x06gb\xca"
+            "\xfa;\x94\x92\x94""0:\xd1\xc2\xe8""4+Y\xdcr$h\x92\x85\xe5}\x98\xc4\xd6\x82\x1b""F8\xc8\x9b PB\x1b\xd7\xac\xf3^\x0f\xd0\xe7\x82\x92\xedn\xb2M<\x96""B8\xa0\x85\x92If\xb2\x8d\x91p\x0c\xe4\x16\0\x04\xc2\x87\xabN\x96\x07\x82\x18\x9e\x14\xe3\xe6\xd6\x8e""7"
+            "J\xe3-\"\xf1\x8e\x91\x9b""D\xe6\x1bo\xf0\xc0!\x8c\xd6\xc4""2\xaa""dVr\xdd\xfe\x0f\xfa\x98""54\xbcM\xd3*k#\xc9\xfd\x04\x80\n"
+            "\x93\x93,\xd2\x98\xc6""0\xb0\xee\xa7\x12\xdc\xb2\xa8\xc0g-y- \x10\x8c\xcb{2\xcf\xcdi~\xca\x07\xcfJ,\xf7\x02\xbe\xa4V&\x1d-\x03\x99\x0ex\xe3*\0o\x9e\0\xe1\xca\xa1\x10\x11:\x8c\xee\xde\xce\xc1\xb5\x97\xed\x8b\tBTy\xaa\x16>_\x9d^^\x8dZ#U@i&=\xca\x10\xe5"
+            "\xb1""c~Q\xeem?<\xf8\xd1\xb0y\xf5\"\xd1\x02\x97""8\xdak~\xfax\xe5\xaf\x8ek\x97o\xf6\x1b\xb1W\xe0}\xb2\xb7|\xf1\xa2\xca\xab\xdcT\xae\xbf\xb7\xfb\xfc\xc7\xad\xf6\x95[5\xfa\xf6ktm\x8d\xbe*\xe9Rc^\x87""7\x9e\xcc\xfc\xc4/\xccT\xa0\x8d\xa8\xa5J\xe5x\xdb\x80"
+            "\xb2z\xf8\xfan\xe7\xd2\xfa\n"
+            "\xdd}\x8b\x96\xf2\xae\xa5X\xa6\tC\xefmo\x1cm_y\xf6\xb5\xee\xe2\xc8%P:\r\xa7\x9c\xa4\xd6:\xe0\xb0\xb4NU7\x1aVz\xb8\xa8Q\x95h\xb1}a\x94\xcbq\xa4\xb9\x9b\xce~\x07\x1a\xff.\xf0;X\xc7\xdb\x0e\xa1\xc6j\x0bNp53T}\xea\x13\xed\xd5\xa9\x13S\xea\x1a""8\x8d\x0b\xdc"
+            "\x12\xedV_\xa0,s\xf4\x91mH\x9et[j\xb9\xf4p\xf5\xf8\x8b\xc7\xdb\xaf\xfeL\xd2{+l\t\xf8\xd6\xd9\xa6\x9f\xa9\x07\x9bW\xebo\xc6\xd3""0E\x03\x9e\xae""9\xc1\x16\xebTO.-\xad\xfd\xc5\xf1\xce\x0f\x7fQ\xbf\xd1\xa8\xb3\xc0\xe0\xd8\xcd}\xbc\xf9\xea\xdf-N\xbdZ\xdb"
+            "\x7f\xd1""0\xee\x17\x1bq\xfb\xee\x1fK\xe0!\xe0.h\xe2\\\xd0\xd9\xdf\xd9\xb9\xf8\x02\x89\x03Pa\xc9\xc6\xce\xb5\xd9\xe5\xda\xe1\xee\t\xdaP\x1dq\xe6\xc5\xed\xf7\xfe\x88X\x89}\xcaq\x0f\x95\x9fV\x90\xc4|\x8eM\x85\xdd\xc3""DG\xc7!P\xa1\x87Z\xa3\xe7\xd6\xc4\xbf"
+            "\t\0\x8c\t\xda\xe7\x91\xf1\x03?9EKO\xa7""6\xe6\x9a\"\xb8g$\xfe\xe1\xc8\x02\x14\xc6\xfdZ\xa2\xdc.\xc2\n"
+            "\x8c\xc2""2\xa1N\xa5!'XZhr}%\xf7m\x0e\xdb\xd9v\xe0W\xfc\x87\xf6\x8d\xceYC\xd4\0\0\0\0IEND\xae""B`\x82";
 
         const char* APILights_png = (const char*)temp_binary_data_2;
 
@@ -736,7 +1064,7 @@ namespace punch {
 
             switch (hash)
             {
-            case 0xd77322a1:  numBytes = 20615; return APILights_png;
+            case 0xd77322a1:  numBytes = 3405; return APILights_png;
             default: break;
             }
 
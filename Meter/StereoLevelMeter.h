@@ -15,18 +15,21 @@
 namespace punch {
 
     //==============================================================================
-    class LevelMeter : public juce::Component
+    class LevelMeter : public juce::Component,
+        public RefreshScheduler::Client
     {
     public:
         LevelMeter(int marginTop, int marginBottom, float minAmp, float maxAmp, float) :
             _mTop(marginTop),
             _mBottom(marginBottom),
             maxAmp(minAmp, maxAmp, 20) {};
+        ~LevelMeter() override;
         void paint(juce::Graphics&);
         virtual void resized() override = 0;
-        void capture(juce::AudioBuffer<float> amps, int channel);
-        void capture(juce::AudioBuffer<double> amps, int channel);
-        virtual void drawLight(juce::Graphics& g, int x, int y, int width, int height, float* levels, int l) = 0;
+        void prepare(double sampleRate, int maxBlockSize, int nChannels = 2);
+        void capture(const juce::AudioBuffer<float>& amps, int channel);
+        void capture(const juce::AudioBuffer<double>& amps, int channel);
+        virtual void drawLight(juce::Graphics& g, int x, int y, int width, int height, bool lit, int l) = 0;
         virtual void drawSignal(juce::Graphics& g, int x, int y, int width, int height, bool signal) = 0;
         virtual void drawClipped(juce::Graphics& g, int x, int y, int width, int height, bool clipped) = 0;
         virtual int getActualHeight() = 0;
@@ -35,6 +38,37 @@ namespace punch {
         virtual bool canSetRange() = 0;
         virtual void setRedLevel(float) {};
         virtual void setOrangeLevel(float) {};
+        virtual void drawBackground(juce::Graphics& g);
+        virtual void drawLitLights(juce::Graphics& g);
+        virtual juce::Rectangle<int> getChangedLights();
+        void fillLights(juce::Graphics& g, int inset);
+        void updateZones(float orangeLevel, float redLevel);
+        int getZone(int l);
+        juce::Colour getZoneColour(int l) { return _zoneColours[getZone(l)]; }
+        void invalidateBackground();
+        void refresh() override;
+
+        /** Renders each frame into an image on the shared RenderPool, paint only
+            composites the finished image. Meant for large bridges where painting every
+            meter on the message thread takes too long. Geometry and zone changes
+            must hold _renderLock, and derived classes turn this off in their destructor.
+        */
+        void setPreRender(bool shouldPreRender);
+        bool isPreRendering() { return _preRender; }
+
+        /** Message thread, under _renderLock. Copies the component size and builds
+            the background and any image caches, so renderFrame, which may run on a
+            worker, draws only from members that nothing else writes meanwhile.
+        */
+        void prepareFrame(float scale);
+        virtual void prepareCaches(float) {};
+        void renderFrame(juce::Graphics& g, float scale);
+        int getLightX();
+        int getLightY(int l);
+        int getClippedY();
+        int getSignalY();
+        juce::Rectangle<int> getLightBounds(int l);
+        void takeSnapshot();
         MaximumAmp maxAmp;
         int _mTop;
         int _mBottom;
@@ -45,18 +79,61 @@ namespace punch {
         int _clippedheight = 0;
         int _signalheight = 0;
         int _nLights = 0;
+        bool _topDown = false;
+        int _layoutWidth = 0;        // component size the lights are laid out for
+        int _layoutHeight = 0;
+        juce::Image _background;     // unlit meter and indicators, redrawn in place after setHeight or zones
+        float _backgroundScale = 0.0f;
+        bool _backgroundDirty = true;
+        int _generation = 0;         // bumped whenever the background changes
+        MeterState _state;           // latest snapshot, left alone while a frame renders
+        MeterState _shown;           // what the screen shows once the issued repaints are done
+        juce::RectangleList<int> _litRects;
+        enum Zone { Red = 0, Orange = 1, Green = 2 };
+        const juce::Colour _zoneColours[3] = { juce::Colour::fromRGB(255, 0, 0), juce::Colours::orange, juce::Colour::fromRGB(0, 255, 0) };
+        std::atomic<int> _orangeStart { 0 };  // first orange light, lights below are green
+        std::atomic<int> _redStart { 0 };     // first red light
+        juce::CriticalSection _renderLock;   // held by the worker while it draws
+
+    private:
+        class RenderJob : public juce::ThreadPoolJob
+        {
+        public:
+            RenderJob(LevelMeter& m) : juce::ThreadPoolJob("punch meter frame"), meter(m) {}
+            JobStatus runJob() override;
+        private:
+            LevelMeter& meter;
+        };
+        void renderOffThread();
+
+        bool _preRender = false;
+        RenderJob _renderJob { *this };
+        juce::SharedResourcePointer<RenderPool> _renderPool;
+        std::atomic<bool> _rendering { false };
+        std::atomic<bool> _frameReady { false };
+        std::atomic<float> _renderScale { 1.0f };
+        float _jobScale = 1.0f;      // scale the queued frame was prepared for
+        int _jobGeneration = 0;
+        int _frameGeneration = -1;   // generation _frame was drawn for, paint skips stale frames
+        juce::SpinLock _frameLock;
+        juce::Image _frame;          // last finished frame, read by paint
+        juce::Image _nextFrame;      // drawn by the worker
+        float _frameScale = 1.0f;
+        juce::Rectangle<int> _pendingDirty;
     };
 
     class DrawnLEDLevelMeter : public LevelMeter
     {
     public:
         DrawnLEDLevelMeter(int marginTop, int marginBottom, float minAmp, float maxAmp, float incAmp);
+        ~DrawnLEDLevelMeter() override;
         void resized() override;
         void setHeight(int height);
         int getActualHeight();
         int getActualWidth();
         void clearClipped();
-        void drawLight(juce::Graphics& g, int x, int y, int width, int height, float* levels, int l);
+        void drawLight(juce::Graphics& g, int x, int y, int width, int height, bool lit, int l);
+        void drawLitLights(juce::Graphics& g) override;
         void drawSignal(juce::Graphics& g, int x, int y, int width, int height, bool signal);
         void drawClipped(juce::Graphics& g, int x, int y, int width, int height, bool clipped);
         bool canSetRange() { return false; }
@@ -64,7 +141,6 @@ namespace punch {
         const juce::Colour _peakColor = juce::Colour::fromRGB(255, 0, 0);
         const juce::Colour _signalColor = juce::Colour::fromRGB(0, 255, 0);
         const float _lightborder = 1.5;
-        juce::Colour* _lightColors = nullptr;
         int _meterWidth = 22;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DrawnLEDLevelMeter);
@@ -74,12 +150,14 @@ namespace punch {
     {
     public:
         SimpleBarLevelMeter(int marginTop, int marginBottom, float minAmp, float maxAmp, float incAmp);
+        ~SimpleBarLevelMeter() override;
         void resized() override;
         void setHeight(int height);
         int getActualHeight();
         int getActualWidth();
         void clearClipped();
-        void drawLight(juce::Graphics& g, int x, int y, int width, int height, float* levels, int l);
+        void drawLight(juce::Graphics& g, int x, int y, int width, int height, bool lit, int l);
+        void drawLitLights(juce::Graphics& g) override;
         void drawSignal(juce::Graphics& g, int x, int y, int width, int height, bool signal);
         void drawClipped(juce::Graphics& g, int x, int y, int width, int height, bool clipped);
         bool canSetRange() { return true; }
@@ -91,7 +169,6 @@ namespace punch {
         const juce::Colour _signalColor = juce::Colour::fromRGB(0, 255, 0);
         float _redLevel = -3.0;
         float _orangeLevel = -18.0;
-        juce::Colour* _lightColors = nullptr;
         int _meterWidth = 22;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SimpleBarLevelMeter);
@@ -100,12 +177,13 @@ namespace punch {
     {
     public:
         UADLevelMeter(int marginTop, int marginBottom, float minAmp, float maxAmp, float incAmp);
+        ~UADLevelMeter() override;
         void resized() override;
         void setHeight(int height);
         int getActualHeight();
         int getActualWidth();
         void clearClipped();
-        void drawLight(juce::Graphics& g, int x, int y, int width, int height, float* levels, int l);
+        void drawLight(juce::Graphics& g, int x, int y, int width, int height, bool lit, int l);
         void drawSignal(juce::Graphics& g, int x, int y, int width, int height, bool signal);
         void drawClipped(juce::Graphics& g, int x, int y, int width, int height, bool clipped);
         bool canSetRange() { return true; }
@@ -113,27 +191,98 @@ namespace punch {
         void setOrangeLevel(float level);
 
     private:
+        void prepareCaches(float scale) override;
+        void drawFrame(juce::Graphics& g, int index, int x, int y);
+        static const int _nFrames = 6;
         const int _clippedImageOn = 3;
         const int _clippedImageOff = 0;
         const int _signalImageOn = 5;
         const int _signalImageOff = 2;
         float _redLevel = -3.0;
         float _orangeLevel = -18.0;
-        int* _lightImageIndexes = nullptr;
         juce::Image _lightImages;
+        juce::Image _frames[_nFrames];  // sliced from _lightImages at the display scale
+        float _framesScale = 0.0f;
         int _meterWidth = 22;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UADLevelMeter);
     };
-    class StereoLevelMeter : public juce::Component,
-        public juce::Timer
+    /** Continuous bar drawn from the dB level rather than quantised lights.
+        Levels map to pixels through the same DbPixelMap as dbAnnoComponent, and the
+        lit bar is blitted from a cached gradient image.
+    */
+    class ContinuousBarLevelMeter : public LevelMeter
+    {
+    public:
+        ContinuousBarLevelMeter(int marginTop, int marginBottom, float minAmp, float maxAmp, float incAmp);
+        ~ContinuousBarLevelMeter() override;
+        void resized() override;
+        void setHeight(int height);
+        int getActualHeight();
+        int getActualWidth();
+        void clearClipped();
+        void drawBackground(juce::Graphics& g) override;
+        void drawLitLights(juce::Graphics& g) override;
+        juce::Rectangle<int> getChangedLights() override;
+        void drawLight(juce::Graphics& g, int x, int y, int width, int height, bool lit, int l);
+        void drawSignal(juce::Graphics& g, int x, int y, int width, int height, bool signal);
+        void drawClipped(juce::Graphics& g, int x, int y, int width, int height, bool clipped);
+        bool canSetRange() { return true; }
+        void setRedLevel(float level);
+        void setOrangeLevel(float level);
+    private:
+        juce::ColourGradient getZoneGradient(float brightness);
+        juce::Rectangle<int> getSpan(int fromY, int toY);
+        const juce::Colour _peakColor = juce::Colour::fromRGB(255, 0, 0);
+        const juce::Colour _signalColor = juce::Colour::fromRGB(0, 255, 0);
+        float _redLevel = -3.0;
+        float _orangeLevel = -18.0;
+        DbPixelMap _map;
+        juce::Image _litBar;     // fully lit bar at the display scale
+        float _litBarScale = 1.0f;
+        int _meterWidth = 22;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ContinuousBarLevelMeter);
+    };
+
+    /** Gain reduction meter fed from matching before/after streams, lit from the top down.
+        The clip light shows reduction beyond the range, the signal light any reduction.
+    */
+    class GainReductionLevelMeter : public LevelMeter
+    {
+    public:
+        GainReductionLevelMeter(int marginTop, int marginBottom, float maxReduction);
+        ~GainReductionLevelMeter() override;
+        void init(int windowSize, int maxLatency);
+        void capture(CompareBuffer& buffer, int channel);
+        void capture(const juce::AudioBuffer<float>& bamps, const juce::AudioBuffer<float>& aamps, int channel, int latency);
+        void resized() override;
+        void setHeight(int height);
+        int getActualHeight();
+        int getActualWidth();
+        void clearClipped();
+        void drawLight(juce::Graphics& g, int x, int y, int width, int height, bool lit, int l);
+        void drawSignal(juce::Graphics& g, int x, int y, int width, int height, bool signal);
+        void drawClipped(juce::Graphics& g, int x, int y, int width, int height, bool clipped);
+        bool canSetRange() { return false; }
+    private:
+        const juce::Colour _reductionColor = juce::Colour::fromRGB(255, 190, 0);
+        GainReductionAmp _grAmp;
+        int _meterWidth = 22;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GainReductionLevelMeter);
+    };
+    class StereoLevelMeter : public juce::Component
     {
     public:
         StereoLevelMeter(float minAmp, float maxAmp, float incAmp, int marginTop, int marginBottom, float leftAnnoWidth, float rightAnnoWidth);
         void resized() override;
         int getNChannels();
-        void capture(juce::AudioBuffer<float> amps);
-        void capture(juce::AudioBuffer<double> amps);
+        void prepare(double sampleRate, int maxBlockSize);
+        void capture(const juce::AudioBuffer<float>& amps, juce::int64 samplePosition = -1);
+        void capture(const juce::AudioBuffer<double>& amps, juce::int64 samplePosition = -1);
+        void setClipEventLog(ClipEventLog* log);
+        void setPreRender(bool shouldPreRender);
         void init();
         void clearClipped();
         bool canSetRange();
@@ -141,7 +290,6 @@ namespace punch {
         int getActualHeight();
         int getActualWidth();
         void setHeight(int height);
-        void timerCallback() override;
     private:
 
         SimpleBarLevelMeter leftLevelMeter;
@@ -158,7 +306,7 @@ namespace punch {
     {
 
         extern const char* APILights_png;
-        const int            APILights_pngSize = 20615;
+        const int            APILights_pngSize = 3405;
 
         // Number of elements in the namedResourceList and originalFileNames arrays.
         const int namedResourceListSize = 1;
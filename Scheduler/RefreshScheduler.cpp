@@ -0,0 +1,63 @@
+/*
+  ==============================================================================
+
+    RefreshScheduler.cpp
+
+  ==============================================================================
+*/
+
+#include "../punch.h"
+
+namespace punch {
+
+    RefreshScheduler::RefreshScheduler()
+    {
+    }
+
+    RefreshScheduler::~RefreshScheduler()
+    {
+        stopTimer();
+    }
+
+    void RefreshScheduler::addClient(Client* client)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+        _clients.addIfNotAlreadyThere(client);
+        if (!isTimerRunning()) startTimerHz(_hz);
+    }
+
+    void RefreshScheduler::removeClient(Client* client)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+        _clients.removeFirstMatchingValue(client);
+        if (_clients.isEmpty()) stopTimer();
+    }
+
+    void RefreshScheduler::setRefreshRate(int hz)
+    {
+        _hz = juce::jmax(1, hz);
+        if (isTimerRunning()) startTimerHz(_hz);
+    }
+
+    void RefreshScheduler::timerCallback()
+    {
+        // Clients may add or remove clients, themselves included, from refresh(),
+        // so walk a copy and skip any that have gone since the frame started.
+        _frameClients.clearQuick();
+        _frameClients.addArray(_clients);
+        for (auto* client : _frameClients)
+        {
+            if (_clients.contains(client)) client->refresh();
+        }
+    }
+
+    RefreshScheduler::Client::Client()
+    {
+        scheduler->addClient(this);
+    }
+
+    RefreshScheduler::Client::~Client()
+    {
+        scheduler->removeClient(this);
+    }
+}
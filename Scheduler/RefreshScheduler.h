@@ -0,0 +1,52 @@
+/*
+  ==============================================================================
+
+    RefreshScheduler.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "../punch.h"
+
+namespace punch {
+
+    /** One shared timer that refreshes every registered client once per display frame.
+
+        Clients register themselves for their lifetime, so a hundred meters cost one
+        timer callback per frame rather than a hundred.
+    */
+    class RefreshScheduler : private juce::Timer
+    {
+    public:
+        class Client;
+
+        RefreshScheduler();
+        ~RefreshScheduler() override;
+        void addClient(Client* client);
+        void removeClient(Client* client);
+        void setRefreshRate(int hz);
+        int getRefreshRate() { return _hz; }
+
+    private:
+        void timerCallback() override;
+        juce::Array<Client*> _clients;
+        juce::Array<Client*> _frameClients;    // clients this frame refreshes, storage is reused
+        int _hz = 60;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RefreshScheduler);
+    };
+
+    class RefreshScheduler::Client
+    {
+    public:
+        Client();
+        virtual ~Client();
+
+        /** Called on the message thread once per frame. */
+        virtual void refresh() = 0;
+    protected:
+        juce::SharedResourcePointer<RefreshScheduler> scheduler;
+    };
+}
@@ -0,0 +1,33 @@
+/*
+  ==============================================================================
+
+    RenderPool.cpp
+
+  ==============================================================================
+*/
+
+#include "../punch.h"
+
+namespace punch {
+
+    void RenderPool::addJob(juce::ThreadPoolJob* job)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+        if (_pool == nullptr)
+        {
+            // leave a core for the message thread and one for audio
+            _pool = std::make_unique<juce::ThreadPool>(juce::jmax(1, juce::SystemStats::getNumCpus() - 2));
+        }
+        _pool->addJob(job, false);
+    }
+
+    bool RenderPool::contains(juce::ThreadPoolJob* job)
+    {
+        return _pool != nullptr && _pool->contains(job);
+    }
+
+    void RenderPool::waitForJob(juce::ThreadPoolJob* job)
+    {
+        if (_pool != nullptr) _pool->waitForJobToFinish(job, -1);
+    }
+}
@@ -0,0 +1,32 @@
+/*
+  ==============================================================================
+
+    RenderPool.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "../punch.h"
+
+namespace punch {
+
+    /** Worker threads shared by every component that renders its frames off the
+        message thread. Hold it through a juce::SharedResourcePointer; the threads
+        are only started by the first addJob().
+    */
+    class RenderPool
+    {
+    public:
+        RenderPool() {};
+        void addJob(juce::ThreadPoolJob* job);
+        void waitForJob(juce::ThreadPoolJob* job);
+        bool contains(juce::ThreadPoolJob* job);
+
+    private:
+        std::unique_ptr<juce::ThreadPool> _pool;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderPool);
+    };
+}
@@ -0,0 +1,161 @@
+/*
+  ==============================================================================
+
+    Oscilloscope.cpp
+
+  ==============================================================================
+*/
+
+#include "../punch.h"
+
+namespace punch {
+
+    Oscilloscope::Oscilloscope(SimpleBuffer& source, int channel, int samplesPerScreen) :
+        _source(source),
+        _channel(channel)
+    {
+        setSamplesPerScreen(samplesPerScreen);
+        setOpaque(true);
+    };
+
+    void Oscilloscope::setChannel(int channel)
+    {
+        _channel = channel;
+    }
+
+    void Oscilloscope::setSamplesPerScreen(int samples)
+    {
+        _samplesPerScreen = juce::jmax(2, samples);
+        _historySize = _samplesPerScreen * 2; // room to find a trigger with a full screen after it
+        _history.malloc(_historySize);
+        _screen.malloc(_samplesPerScreen);
+        _hasScreen = false;
+        _trace.clear();
+    }
+
+    void Oscilloscope::setTrigger(TriggerMode mode, float level, float hysteresis)
+    {
+        _triggerMode = mode;
+        _triggerLevel = mode == TriggerMode::ZeroCrossing ? 0.0f : level;
+        _hysteresis = std::abs(hysteresis);
+    }
+
+    void Oscilloscope::setMaxAmp(float maxAmp)
+    {
+        _maxAmp = maxAmp > 0.0f ? maxAmp : 1.0f;
+    }
+
+    int Oscilloscope::findTrigger(const float* data, int nSamples, float level, float hysteresis)
+    {
+        // Chunks that cannot arm or fire the trigger are rejected with a vectorised
+        // min/max, so only chunks that contain an edge are scanned sample by sample.
+        const int chunkSize = 32;
+        const float armLevel = level - hysteresis;
+        bool armed = false;
+
+        for (int start = 0; start < nSamples; start += chunkSize)
+        {
+            int n = juce::jmin(chunkSize, nSamples - start);
+            auto range = juce::FloatVectorOperations::findMinAndMax(data + start, n);
+            if (!armed && range.getStart() > armLevel) continue;
+            if (armed && range.getEnd() < level) continue;
+
+            for (int i = start; i < start + n; i++)
+            {
+                if (!armed)
+                {
+                    armed = data[i] <= armLevel;
+                }
+                else if (data[i] >= level)
+                {
+                    return i;
+                }
+            }
+        }
+        return -1;
+    }
+
+    void Oscilloscope::refresh()
+    {
+        int n = _source.copyLatest(_channel, _history, _historySize);
+        if (n < _samplesPerScreen) return; // keep the last trace until a full screen arrives
+
+        int start = n - _samplesPerScreen; // free run shows the latest screen
+        _triggered = false;
+        if (_triggerMode != TriggerMode::FreeRun)
+        {
+            int t = findTrigger(_history, start + 1, _triggerLevel, _hysteresis);
+            if (t >= 0)
+            {
+                start = t;
+                _triggered = true;
+            }
+        }
+
+        juce::FloatVectorOperations::copy(_screen, _history + start, _samplesPerScreen);
+        _hasScreen = true;
+        buildPath(_screen);
+        repaint();
+    }
+
+    float Oscilloscope::getYFromAmp(float amp)
+    {
+        float centre = (float)getHeight() * 0.5f;
+        return centre - juce::jlimit(-1.0f, 1.0f, amp / _maxAmp) * centre;
+    }
+
+    void Oscilloscope::buildPath(const float* data)
+    {
+        _trace.clear();
+        int width = getWidth();
+        if (width <= 0) return;
+
+        if (_samplesPerScreen <= width)
+        {
+            float xScale = (float)width / (float)(_samplesPerScreen - 1);
+            _trace.startNewSubPath(0.0f, getYFromAmp(data[0]));
+            for (int i = 1; i < _samplesPerScreen; i++)
+            {
+                _trace.lineTo((float)i * xScale, getYFromAmp(data[i]));
+            }
+            return;
+        }
+
+        // Zoomed out: one vertical min/max segment per pixel column. Each column also
+        // covers the last sample of the previous one so neighbouring segments join.
+        for (int x = 0; x < width; x++)
+        {
+            int s0 = (int)((juce::int64)x * _samplesPerScreen / width);
+            int s1 = (int)((juce::int64)(x + 1) * _samplesPerScreen / width);
+            if (x > 0) s0--;
+            auto range = juce::FloatVectorOperations::findMinAndMax(data + s0, s1 - s0);
+            float top = getYFromAmp(range.getEnd());
+            float bottom = juce::jmax(getYFromAmp(range.getStart()), top + 1.0f);
+            _trace.startNewSubPath((float)x + 0.5f, top);
+            _trace.lineTo((float)x + 0.5f, bottom);
+        }
+    }
+
+    void Oscilloscope::paint(juce::Graphics& g)
+    {
+        g.fillAll(juce::Colours::black);
+
+        g.setColour(juce::Colours::grey);
+        g.drawHorizontalLine(getHeight() / 2, 0.0f, (float)getWidth());
+
+        if (_triggerMode != TriggerMode::FreeRun)
+        {
+            g.setColour(_triggered ? juce::Colours::darkgrey : juce::Colours::darkred);
+            g.drawHorizontalLine((int)getYFromAmp(_triggerLevel), 0.0f, (float)getWidth());
+        }
+
+        g.setColour(juce::Colour::fromRGB(0, 255, 0));
+        g.strokePath(_trace, juce::PathStrokeType(1.0f));
+    }
+
+    void Oscilloscope::resized()
+    {
+        if (_hasScreen) buildPath(_screen);
+        refresh();
+    }
+}
@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+
+    Oscilloscope.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "../punch.h"
+
+namespace punch {
+
+    //==============================================================================
+    /** Triggered waveform view over the history held in a SimpleBuffer.
+
+        Each refresh copies the latest history, searches it for a trigger point and
+        rebuilds a path with at most one segment per pixel column. While the history
+        holds less than a screen, after a clear or an overflow, the last trace stays.
+    */
+    class Oscilloscope : public juce::Component,
+        public RefreshScheduler::Client
+    {
+    public:
+        enum TriggerMode {
+            FreeRun, ZeroCrossing, Threshold
+        };
+        Oscilloscope(SimpleBuffer& source, int channel = 0, int samplesPerScreen = 1024);
+        void paint(juce::Graphics& g) override;
+        void resized() override;
+        void refresh() override;
+        void setChannel(int channel);
+        void setSamplesPerScreen(int samples);
+        void setTrigger(TriggerMode mode, float level = 0.0f, float hysteresis = 0.01f);
+        void setMaxAmp(float maxAmp);
+        int getSamplesPerScreen() { return _samplesPerScreen; }
+
+        /** Returns the index of the first rising crossing of level in data, or -1.
+            The signal must first fall to level - hysteresis to arm the trigger.
+        */
+        static int findTrigger(const float* data, int nSamples, float level, float hysteresis);
+
+    private:
+        void buildPath(const float* data);
+        float getYFromAmp(float amp);
+
+        SimpleBuffer& _source;
+        int _channel;
+        int _samplesPerScreen;
+        TriggerMode _triggerMode = TriggerMode::ZeroCrossing;
+        float _triggerLevel = 0.0f;
+        float _hysteresis = 0.01f;
+        float _maxAmp = 1.0f;
+        juce::HeapBlock<float> _history;
+        int _historySize = 0;
+        juce::HeapBlock<float> _screen;    // samples of the trace on screen
+        bool _hasScreen = false;
+        juce::Path _trace;
+        bool _triggered = false;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Oscilloscope);
+    };
+}
@@ -13,12 +13,67 @@ namespace punch
     using Mouse = juce::MouseEvent;
     using Wheel = juce::MouseWheelDetails;
 
+    static const int wheelGestureIdleFrames = 8;
+
     void SmoothSlider::mouseWheelMove(const Mouse& mouse, const Wheel& wheel)
     {
         auto newWheel = wheel;
         const auto speed = mouse.mods.isCtrlDown() ? SensitiveWheel : NormalWheel;
         newWheel.deltaY *= speed;
-        
-        Slider::mouseWheelMove(mouse, newWheel);
-    }  
-}
\ No newline at end of file
+
+        if (!_accumulateWheel || !isEnabled() || !isScrollWheelEnabled() || isTwoValue() || isThreeValue()
+            || getSliderStyle() == IncDecButtons || mouse.mods.isAnyMouseButtonDown())
+        {
+            Slider::mouseWheelMove(mouse, newWheel);
+            return;
+        }
+
+        // Same direction rules as Slider, the value itself moves in applyWheel().
+        // deltaX stays unscaled, as it does on the Slider path above.
+        float amount = std::abs(newWheel.deltaX) > std::abs(newWheel.deltaY) ? -newWheel.deltaX : newWheel.deltaY;
+        _wheelAmount += amount * (wheel.isReversed ? -1.0f : 1.0f);
+        _wheelIdleFrames = 0;
+        if (_wheelGesture == nullptr) _wheelGesture = std::make_unique<Slider::ScopedDragNotification>(*this);
+    }
+
+    void SmoothSlider::setWheelAccumulation(bool shouldAccumulate)
+    {
+        _accumulateWheel = shouldAccumulate;
+        if (shouldAccumulate)
+        {
+            if (_wheelRefresh == nullptr) _wheelRefresh = std::make_unique<WheelRefresh>(*this);
+        }
+        else
+        {
+            endWheelGesture();
+            _wheelRefresh.reset();
+        }
+    }
+
+    void SmoothSlider::endWheelGesture()
+    {
+        _wheelAmount = 0.0;
+        _wheelGesture.reset();
+    }
+
+    void SmoothSlider::applyWheel()
+    {
+        if (_wheelGesture == nullptr) return;
+        if (!isEnabled()) { endWheelGesture(); return; }
+
+        if (_wheelAmount == 0.0)
+        {
+            if (++_wheelIdleFrames >= wheelGestureIdleFrames) endWheelGesture();
+            return;
+        }
+
+        // One value change per frame, proportional like Slider's own wheel handling.
+        auto value = getValue();
+        auto newPos = valueToProportionOfLength(value) + _wheelAmount * 0.15;
+        newPos = (isRotary() && !getRotaryParameters().stopAtEnd) ? newPos - std::floor(newPos) : juce::jlimit(0.0, 1.0, newPos);
+        _wheelAmount = 0.0;
+
+        auto delta = proportionOfLengthToValue(newPos) - value;
+        if (delta != 0.0) setValue(snapValue(value + juce::jmax(getInterval(), std::abs(delta)) * (delta < 0 ? -1.0 : 1.0), notDragging), juce::sendNotificationSync);
+    }
+}
@@ -18,8 +18,28 @@ namespace punch
         SmoothSlider(float nWheel, float sWheel) : Slider(), NormalWheel(nWheel), SensitiveWheel(sWheel) {}
 
         void mouseWheelMove(const juce::MouseEvent& mouse, const juce::MouseWheelDetails& wheel) override;
+
+        /** Integrates wheel input and applies it at most once per frame. A burst of
+            wheel events becomes one gesture, ended once the wheel has been idle for
+            a few frames, so hosts record one automation pass instead of hundreds.
+        */
+        void setWheelAccumulation(bool shouldAccumulate);
     private:
+        // Registered with the RefreshScheduler only while accumulation is on.
+        struct WheelRefresh : public RefreshScheduler::Client
+        {
+            WheelRefresh(SmoothSlider& s) : slider(s) {}
+            void refresh() override { slider.applyWheel(); }
+            SmoothSlider& slider;
+        };
+        void applyWheel();
+        void endWheelGesture();
         float NormalWheel = .8f;
         float SensitiveWheel = .05f;
+        bool _accumulateWheel = false;
+        double _wheelAmount = 0.0;      // pending, in wheel units
+        int _wheelIdleFrames = 0;
+        std::unique_ptr<juce::Slider::ScopedDragNotification> _wheelGesture;
+        std::unique_ptr<WheelRefresh> _wheelRefresh;
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,281 @@
+/*
+  ==============================================================================
+
+    ChannelStrip.cpp
+
+  ==============================================================================
+*/
+
+#include "../punch.h"
+
+namespace punch {
+
+    ChannelStrip::ChannelStrip(float minAmp, float maxAmp, float incAmp, int marginTop, int marginBottom) :
+        _amps{ { minAmp, maxAmp, 20 }, { minAmp, maxAmp, 20 } },
+        _incAmp(incAmp),
+        _mTop(marginTop),
+        _mBottom(marginBottom)
+    {
+        _map.setRange(minAmp, maxAmp);
+        // Not a child: the strip draws the fader and forwards its mouse input.
+        _fader.setSliderStyle(juce::Slider::LinearVertical);
+        _fader.setTextBoxStyle(juce::Slider::NoTextBox, true, 0, 0);
+        _fader.setRange(minAmp, maxAmp, 0.1);
+        setOpaque(false);
+    }
+
+    void ChannelStrip::prepare(double sampleRate, int maxBlockSize)
+    {
+        for (auto& amp : _amps) amp.prepare(sampleRate, maxBlockSize, _nChannels);
+    }
+
+    void ChannelStrip::capture(const juce::AudioBuffer<float>& amps)
+    {
+        if (amps.getNumChannels() == 0) return;
+        bool mono = amps.getNumChannels() == 1;
+        _isMono = mono;
+        for (int c = 0; c < (mono ? 1 : _nChannels); c++) _amps[c].capture(amps, c);
+    }
+
+    void ChannelStrip::capture(const juce::AudioBuffer<double>& amps)
+    {
+        if (amps.getNumChannels() == 0) return;
+        bool mono = amps.getNumChannels() == 1;
+        _isMono = mono;
+        for (int c = 0; c < (mono ? 1 : _nChannels); c++) _amps[c].capture(amps, c);
+    }
+
+    void ChannelStrip::setOrangeLevel(float level)
+    {
+        _orangeLevel = level;
+        _backgroundDirty = true;
+        repaint(_meterArea);
+    }
+
+    void ChannelStrip::setRedLevel(float level)
+    {
+        _redLevel = level;
+        _backgroundDirty = true;
+        repaint(_meterArea);
+    }
+
+    void ChannelStrip::clearClipped()
+    {
+        for (auto& amp : _amps) amp.setClipped(false);
+    }
+
+    void ChannelStrip::resized()
+    {
+        // fader | scale | meter, the scale and the bars share _map
+        auto r = getLocalBounds();
+        int meterWidth = _nChannels * _barWidth + (_nChannels + 1) * _barSpacing;
+        _meterArea = r.removeFromRight(meterWidth);
+        _scaleArea = r.removeFromRight(juce::jmin(30, r.getWidth() / 3));
+        _faderArea = r;
+
+        int bottom = getHeight() - _mBottom;
+        _map.setPixels(bottom, _mTop);
+        for (auto& amp : _amps) amp.setNLevels(juce::jmax(1, bottom - _mTop));
+        _faderY = _shownFaderY = _map.getYFromTable(_fader.getValue());
+        _backgroundDirty = true;
+    }
+
+    juce::Rectangle<int> ChannelStrip::getThumb(int y)
+    {
+        return _faderLookAndFeel.getThumbBounds((float)_faderArea.getCentreX(), (float)y);
+    }
+
+    void ChannelStrip::setFaderFromY(int y)
+    {
+        // Below the bottom of the scale the fader goes to its minimum, which may be
+        // lower than the scale, such as -inf.
+        y += _grabOffset;
+        double db = y >= _map.getMinY() ? _fader.getMinimum() : _map.getDb((float)y);
+        db = juce::jlimit(_fader.getMinimum(), _fader.getMaximum(), db);
+        _fader.setValue(_fader.snapValue(db, juce::Slider::absoluteDrag), juce::sendNotificationSync);
+    }
+
+    void ChannelStrip::mouseDown(const juce::MouseEvent& e)
+    {
+        if (!_faderArea.contains(e.getPosition()) || !_fader.isEnabled()) return;
+        _faderDrag = std::make_unique<juce::Slider::ScopedDragNotification>(_fader);
+
+        // grabbing the thumb keeps it under the mouse, a click on the track jumps there
+        _grabOffset = getThumb(_faderY).contains(e.getPosition()) ? _faderY - e.y : 0;
+        setFaderFromY(e.y);
+    }
+
+    void ChannelStrip::mouseDrag(const juce::MouseEvent& e)
+    {
+        if (_faderDrag != nullptr) setFaderFromY(e.y);
+    }
+
+    void ChannelStrip::mouseUp(const juce::MouseEvent&)
+    {
+        _faderDrag.reset();
+    }
+
+    void ChannelStrip::mouseDoubleClick(const juce::MouseEvent& e)
+    {
+        if (!_faderArea.contains(e.getPosition()) || !_fader.isEnabled() || !_fader.isDoubleClickReturnEnabled()) return;
+        // the second press of the double click already started a gesture, mouseUp ends it
+        if (_faderDrag == nullptr) _faderDrag = std::make_unique<juce::Slider::ScopedDragNotification>(_fader);
+        _fader.setValue(_fader.getDoubleClickReturnValue(), juce::sendNotificationSync);
+    }
+
+    void ChannelStrip::mouseWheelMove(const juce::MouseEvent& e, const juce::MouseWheelDetails& wheel)
+    {
+        if (_faderArea.contains(e.getPosition())) _fader.mouseWheelMove(e, wheel);
+        else Component::mouseWheelMove(e, wheel);
+    }
+
+    juce::Rectangle<int> ChannelStrip::getBar(int channel)
+    {
+        int x = _meterArea.getX() + _barSpacing + channel * (_barWidth + _barSpacing);
+        return { x, _map.getMaxY(), _barWidth, _map.getMinY() - _map.getMaxY() };
+    }
+
+    juce::Rectangle<int> ChannelStrip::getClipLight(int channel)
+    {
+        auto bar = getBar(channel);
+        return { bar.getX(), bar.getY() - _clipHeight - 3, _barWidth, _clipHeight };
+    }
+
+    juce::Colour ChannelStrip::getZoneColour(float db)
+    {
+        if (db >= _redLevel) return _red;
+        if (db >= _orangeLevel) return _orange;
+        return _green;
+    }
+
+    void ChannelStrip::takeSnapshot()
+    {
+        for (int c = 0; c < _nChannels; c++)
+        {
+            _state[c] = _amps[c].getState();
+            _amps[c].clear();
+        }
+        _mono = _isMono.load();
+        _faderY = _map.getYFromTable(_fader.getValue());
+    }
+
+    juce::Rectangle<int> ChannelStrip::getChangedArea(int channel)
+    {
+        auto& now = _state[channel];
+        auto& shown = _shown[channel];
+        auto bar = getBar(channel);
+        auto span = [&](int y1, int y2) { return juce::Rectangle<int>(bar.getX(), juce::jmin(y1, y2), _barWidth, std::abs(y2 - y1) + 2); };
+
+        juce::Rectangle<int> dirty;
+        int levelY = _map.getYFromTable(now.level);
+        int shownLevelY = _map.getYFromTable(shown.level);
+        if (levelY != shownLevelY) dirty = span(levelY, shownLevelY);
+        int holdY = _map.getYFromTable(now.holdLevel);
+        int shownHoldY = _map.getYFromTable(shown.holdLevel);
+        if (holdY != shownHoldY) dirty = dirty.getUnion(span(holdY, holdY)).getUnion(span(shownHoldY, shownHoldY));
+        if (now.clipped != shown.clipped) dirty = dirty.getUnion(getClipLight(channel));
+        return dirty;
+    }
+
+    void ChannelStrip::refresh()
+    {
+        if (!isShowing()) return;
+        takeSnapshot();
+
+        if (_fader.isEnabled() != _faderEnabled)
+        {
+            _faderEnabled = _fader.isEnabled();
+            _backgroundDirty = true;
+            repaint(_faderArea);
+        }
+
+        // one repaint region for the fader and both bars
+        juce::Rectangle<int> dirty;
+        for (int c = 0; c < _nChannels; c++) dirty = dirty.getUnion(getChangedArea(c));
+        if (_mono != _shownMono) dirty = dirty.getUnion(getBar(1)).getUnion(getClipLight(1));
+        if (_faderY != _shownFaderY) dirty = dirty.getUnion(getThumb(_faderY)).getUnion(getThumb(_shownFaderY));
+        if (dirty.isEmpty()) return;
+
+        // the region covers everything that differs, so once painted the screen shows the snapshot
+        for (int c = 0; c < _nChannels; c++) _shown[c] = _state[c];
+        _shownMono = _mono;
+        _shownFaderY = _faderY;
+        repaint(dirty);
+    }
+
+    void ChannelStrip::drawBackground(juce::Graphics& g)
+    {
+        _faderLookAndFeel.drawTrack(g, _faderArea.getX(), _map.getMaxY(), _faderArea.getWidth(), _map.getMinY() - _map.getMaxY(), _fader);
+        dbAnnoComponent::drawScale(g, _map, _scaleArea, _incAmp, juce::Justification::right, false);
+
+        for (int c = 0; c < _nChannels; c++)
+        {
+            auto bar = getBar(c);
+            juce::ColourGradient dim(_green.withMultipliedBrightness(0.25f), 0.0f, (float)bar.getBottom(),
+                _red.withMultipliedBrightness(0.25f), 0.0f, (float)bar.getY(), false);
+            auto proportion = [&](float db) { return juce::jlimit(0.0, 1.0, (double)(((float)bar.getBottom() - _map.getY(db)) / (float)juce::jmax(1, bar.getHeight()))); };
+            dim.addColour(proportion(_orangeLevel), _orange.withMultipliedBrightness(0.25f));
+            dim.addColour(proportion(_redLevel), _red.withMultipliedBrightness(0.25f));
+            g.setGradientFill(dim);
+            g.fillRect(bar);
+
+            g.setColour(_red.withMultipliedBrightness(0.25f));
+            g.fillRect(getClipLight(c));
+        }
+    }
+
+    void ChannelStrip::drawBar(juce::Graphics& g, int channel)
+    {
+        auto& state = _state[channel];
+        auto bar = getBar(channel);
+        int levelY = _map.getYFromTable(state.level);
+        int orangeY = _map.getYFromTable(_orangeLevel);
+        int redY = _map.getYFromTable(_redLevel);
+
+        // lit span in at most three solid fills, one per zone
+        auto fillZone = [&](int top, int bottom, juce::Colour colour)
+        {
+            top = juce::jmax(top, levelY);
+            if (top >= bottom) return;
+            g.setColour(colour);
+            g.fillRect(bar.getX(), top, _barWidth, bottom - top);
+        };
+        fillZone(orangeY, bar.getBottom(), _green);
+        fillZone(redY, orangeY, _orange);
+        fillZone(bar.getY(), redY, _red);
+
+        int holdY = _map.getYFromTable(state.holdLevel);
+        if (holdY < levelY - 1)
+        {
+            g.setColour(getZoneColour(state.holdLevel));
+            g.fillRect(bar.getX(), holdY, _barWidth, 2);
+        }
+        if (state.clipped)
+        {
+            g.setColour(_red);
+            g.fillRect(getClipLight(channel));
+        }
+    }
+
+    void ChannelStrip::paint(juce::Graphics& g)
+    {
+        float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        int bw = juce::jmax(1, juce::roundToInt((float)getWidth() * scale));
+        int bh = juce::jmax(1, juce::roundToInt((float)getHeight() * scale));
+        bool resize = scale != _backgroundScale || _background.getWidth() != bw || _background.getHeight() != bh;
+        if (resize || _backgroundDirty)
+        {
+            if (resize) _background = juce::Image(juce::Image::ARGB, bw, bh, true);
+            else _background.clear(_background.getBounds());
+            juce::Graphics bg(_background);
+            bg.addTransform(juce::AffineTransform::scale(scale));
+            drawBackground(bg);
+            _backgroundScale = scale;
+            _backgroundDirty = false;
+        }
+        g.drawImageTransformed(_background, juce::AffineTransform::scale(1.0f / scale));
+
+        for (int c = 0; c < (_mono ? 1 : _nChannels); c++) drawBar(g, c);
+        _faderLookAndFeel.drawThumb(g, (float)_faderArea.getCentreX(), (float)_faderY);
+    }
+}
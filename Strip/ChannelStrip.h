@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    ChannelStrip.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "../punch.h"
+
+namespace punch {
+
+    /** Fader, dB scale and stereo meter as one component.
+
+        The fader, the scale and both meter bars share one DbPixelMap and one cached
+        background. Once per frame a single snapshot is taken of both channels and
+        the fader position, and everything that changed is repainted as one region.
+        The fader's value is in dB and its travel follows the map, so it lines up
+        with the scale next to it. getFader() is an input-only FaderSlider for
+        parameter binding. The strip draws it and forwards mouse input to it, so
+        do not add it to another component.
+    */
+    class ChannelStrip : public juce::Component,
+        private RefreshScheduler::Client
+    {
+    public:
+        ChannelStrip(float minAmp, float maxAmp, float incAmp, int marginTop, int marginBottom);
+        FaderSlider& getFader() { return _fader; }
+        void prepare(double sampleRate, int maxBlockSize);
+        void capture(const juce::AudioBuffer<float>& amps);
+        void capture(const juce::AudioBuffer<double>& amps);
+        void setOrangeLevel(float level);
+        void setRedLevel(float level);
+        void clearClipped();
+        void paint(juce::Graphics& g) override;
+        void resized() override;
+        void mouseDown(const juce::MouseEvent& e) override;
+        void mouseDrag(const juce::MouseEvent& e) override;
+        void mouseUp(const juce::MouseEvent& e) override;
+        void mouseDoubleClick(const juce::MouseEvent& e) override;
+        void mouseWheelMove(const juce::MouseEvent& e, const juce::MouseWheelDetails& wheel) override;
+
+    private:
+        void refresh() override;
+        void takeSnapshot();
+        void setFaderFromY(int y);
+        juce::Rectangle<int> getThumb(int y);
+        void drawBackground(juce::Graphics& g);
+        void drawBar(juce::Graphics& g, int channel);
+        juce::Colour getZoneColour(float db);
+        juce::Rectangle<int> getBar(int channel);
+        juce::Rectangle<int> getClipLight(int channel);
+        juce::Rectangle<int> getChangedArea(int channel);
+
+        static const int _nChannels = 2;
+        static const int _barWidth = 8;
+        static const int _barSpacing = 3;
+        static const int _clipHeight = 6;
+        const juce::Colour _green = juce::Colour::fromRGB(0, 255, 0);
+        const juce::Colour _orange = juce::Colours::orange;
+        const juce::Colour _red = juce::Colour::fromRGB(255, 0, 0);
+
+        FaderSlider _fader;
+        FaderSliderLookAndFeel _faderLookAndFeel;   // draws the fader track and thumb
+        std::unique_ptr<juce::Slider::ScopedDragNotification> _faderDrag;
+        int _grabOffset = 0;         // thumb centre minus the mouse y while dragging
+        MaximumAmp _amps[_nChannels];
+        MeterState _state[_nChannels];
+        MeterState _shown[_nChannels];
+        int _faderY = 0;             // thumb centre in the snapshot
+        int _shownFaderY = 0;
+        bool _faderEnabled = true;   // the track is drawn into the background for this
+        bool _mono = false;          // _isMono in the snapshot
+        bool _shownMono = false;
+        DbPixelMap _map;
+        float _incAmp;
+        int _mTop;
+        int _mBottom;
+        float _orangeLevel = -18.0f;
+        float _redLevel = -3.0f;
+        std::atomic<bool> _isMono { false };
+        juce::Rectangle<int> _faderArea;
+        juce::Rectangle<int> _scaleArea;
+        juce::Rectangle<int> _meterArea;
+        juce::Image _background;     // fader track, scale and unlit bars, redrawn in place on zone changes
+        float _backgroundScale = 0.0f;
+        bool _backgroundDirty = true;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ChannelStrip);
+    };
+}
@@ -0,0 +1,308 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+
+    Batch peak/RMS analyzer. Runs the punch capture engines over a list of audio
+    files on a thread pool and writes a JSON or CSV report next to each file.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <map>
+
+namespace
+{
+    const double rmsWindowSeconds = 0.3;
+
+    struct Options
+    {
+        int nThreads = juce::SystemStats::getNumCpus();
+        double chunkSeconds = 30.0;
+        bool csv = false;
+        juce::File outputDir;
+        juce::Array<juce::File> files;
+    };
+
+    struct ChannelStats
+    {
+        double peakDb = -144.0;
+        double maxRmsDb = -144.0;
+        double sumSquares = 0.0;
+        bool clipped = false;
+    };
+
+    // One input file, split into chunks that any worker can claim.
+    struct FileJob
+    {
+        juce::File file;
+        double sampleRate = 0.0;
+        juce::int64 lengthInSamples = 0;
+        int nChannels = 0;
+        int rmsWindow = 0;
+        int chunkSamples = 0;
+        int nChunks = 0;
+        std::atomic<int> nextChunk { 0 };
+        std::atomic<int> chunksDone { 0 };
+        juce::CriticalSection statsLock;
+        std::vector<ChannelStats> stats;
+        juce::String error;         // set when the file could not be analysed in full
+    };
+
+    class Analyzer
+    {
+    public:
+        Analyzer(const Options& o) : options(o)
+        {
+            formatManager.registerBasicFormats();
+        }
+
+        int run()
+        {
+            for (auto& f : options.files)
+            {
+                if (!open(f))
+                {
+                    std::cerr << "Cannot read " << f.getFullPathName() << std::endl;
+                    failures++;
+                }
+            }
+
+            // Longest files first so the tail of the batch is the cheap work.
+            std::sort(jobs.begin(), jobs.end(), [](const std::unique_ptr<FileJob>& a, const std::unique_ptr<FileJob>& b)
+                { return a->lengthInSamples > b->lengthInSamples; });
+
+            // Files without samples have no chunks, so no worker would ever report them.
+            for (auto& job : jobs)
+                if (job->nChunks == 0) writeResult(*job);
+
+            juce::OwnedArray<Worker> workers;
+            juce::ThreadPool pool(juce::jmax(1, options.nThreads));
+            for (int i = 0; i < (int)jobs.size(); i++)
+            {
+                pool.addJob(workers.add(new Worker(*this, i)), false);
+            }
+            for (auto* w : workers) pool.waitForJobToFinish(w, -1);
+
+            return failures.load() == 0 ? 0 : 1;
+        }
+
+    private:
+        // Each worker owns one file but steals chunks from the others once its own
+        // file has no unclaimed chunks left, so one long file still spreads across cores.
+        class Worker : public juce::ThreadPoolJob
+        {
+        public:
+            Worker(Analyzer& a, int home) : juce::ThreadPoolJob("PunchAnalyzer worker"), analyzer(a), homeIndex(home) {}
+
+            JobStatus runJob() override
+            {
+                int n = (int)analyzer.jobs.size();
+                for (int i = 0; i < n && !shouldExit(); i++)
+                {
+                    drain(*analyzer.jobs[(homeIndex + i) % n]);
+                }
+                return jobHasFinished;
+            }
+
+        private:
+            void drain(FileJob& job)
+            {
+                int c;
+                while (!shouldExit() && (c = job.nextChunk.fetch_add(1)) < job.nChunks)
+                {
+                    analyzer.analyseChunk(job, c, getReader(job), chunk);
+                    if (++job.chunksDone == job.nChunks) analyzer.writeResult(job);
+                }
+            }
+
+            juce::AudioFormatReader* getReader(FileJob& job)
+            {
+                auto& reader = readers[&job];
+                if (reader == nullptr) reader.reset(analyzer.formatManager.createReaderFor(job.file));
+                return reader.get();
+            }
+
+            Analyzer& analyzer;
+            int homeIndex;
+            std::map<FileJob*, std::unique_ptr<juce::AudioFormatReader>> readers;
+            juce::AudioBuffer<float> chunk;
+        };
+
+        bool open(const juce::File& f)
+        {
+            std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(f));
+            if (reader == nullptr || reader->sampleRate <= 0.0) return false;
+
+            auto job = std::make_unique<FileJob>();
+            job->file = f;
+            job->sampleRate = reader->sampleRate;
+            job->lengthInSamples = reader->lengthInSamples;
+            job->nChannels = (int)reader->numChannels;
+            job->rmsWindow = juce::jmax(1, juce::roundToInt(reader->sampleRate * rmsWindowSeconds));
+
+            // Chunks are whole RMS windows, so results do not depend on the chunking.
+            int windowsPerChunk = juce::jmax(1, juce::roundToInt(options.chunkSeconds / rmsWindowSeconds));
+            job->chunkSamples = windowsPerChunk * job->rmsWindow;
+            job->nChunks = (int)(juce::jmax((juce::int64)0, job->lengthInSamples + job->chunkSamples - 1) / job->chunkSamples);
+            job->stats.resize((size_t)job->nChannels);
+            if (job->lengthInSamples <= 0 || job->nChannels <= 0) job->error = "no samples";
+            jobs.push_back(std::move(job));
+            return true;
+        }
+
+        void analyseChunk(FileJob& job, int c, juce::AudioFormatReader* reader, juce::AudioBuffer<float>& chunk)
+        {
+            juce::int64 start = (juce::int64)c * job.chunkSamples;
+            int n = (int)juce::jmin((juce::int64)job.chunkSamples, job.lengthInSamples - start);
+            chunk.setSize(job.nChannels, n, false, false, true);
+            if (reader == nullptr || !reader->read(&chunk, 0, n, start, true, true))
+            {
+                const juce::ScopedLock lock(job.statsLock);
+                job.error = "read failed at sample " + juce::String(start);
+                return;
+            }
+
+            std::vector<ChannelStats> local((size_t)job.nChannels);
+            for (int ch = 0; ch < job.nChannels; ch++)
+            {
+                punch::MaximumAmp peak(-144.0, 0.0, 1, punch::AmpType::Peak);
+                punch::MaximumAmp rms(-144.0, 0.0, 1, punch::AmpType::RMS);
+                peak.prepare(job.sampleRate, job.chunkSamples, job.nChannels);
+                rms.prepare(job.sampleRate, job.chunkSamples, job.nChannels);
+                rms.setWindow(rmsWindowSeconds * 1000.0, 0.0);
+                peak.clear();
+                rms.clear();
+
+                // Back to back windows from the chunk start, a short last window is read on flush.
+                peak.capture(chunk, ch);
+                rms.capture(chunk, ch);
+                rms.flush();
+
+                auto chunkRms = (double)chunk.getRMSLevel(ch, 0, n);
+                auto& stats = local[(size_t)ch];
+                stats.peakDb = peak.getPeakAmp();
+                stats.maxRmsDb = rms.getPeakAmp();
+                stats.sumSquares = chunkRms * chunkRms * (double)n;
+                stats.clipped = peak.clipped();
+            }
+
+            const juce::ScopedLock lock(job.statsLock);
+            for (size_t ch = 0; ch < local.size(); ch++)
+            {
+                auto& stats = job.stats[ch];
+                stats.peakDb = juce::jmax(stats.peakDb, local[ch].peakDb);
+                stats.maxRmsDb = juce::jmax(stats.maxRmsDb, local[ch].maxRmsDb);
+                stats.sumSquares += local[ch].sumSquares;
+                stats.clipped = stats.clipped || local[ch].clipped;
+            }
+        }
+
+        double getRmsDb(const FileJob& job, const ChannelStats& stats)
+        {
+            if (job.lengthInSamples == 0) return -144.0;
+            return juce::Decibels::gainToDecibels(std::sqrt(stats.sumSquares / (double)job.lengthInSamples), -144.0);
+        }
+
+        juce::String toJson(FileJob& job)
+        {
+            auto* root = new juce::DynamicObject();
+            root->setProperty("file", job.file.getFullPathName());
+            root->setProperty("sampleRate", job.sampleRate);
+            root->setProperty("lengthSamples", job.lengthInSamples);
+            root->setProperty("channels", job.nChannels);
+            if (job.error.isNotEmpty()) root->setProperty("error", job.error);
+
+            juce::Array<juce::var> channels;
+            for (int ch = 0; ch < job.nChannels; ch++)
+            {
+                auto& stats = job.stats[(size_t)ch];
+                auto* c = new juce::DynamicObject();
+                c->setProperty("channel", ch);
+                c->setProperty("peakDb", stats.peakDb);
+                c->setProperty("maxRms300msDb", stats.maxRmsDb);
+                c->setProperty("rmsDb", getRmsDb(job, stats));
+                c->setProperty("clipped", stats.clipped);
+                channels.add(juce::var(c));
+            }
+            root->setProperty("channelStats", channels);
+            return juce::JSON::toString(juce::var(root));
+        }
+
+        juce::String toCsv(FileJob& job)
+        {
+            juce::String out = "file,channel,peak_db,max_rms_300ms_db,rms_db,clipped,error\n";
+            for (int ch = 0; ch < job.nChannels; ch++)
+            {
+                auto& stats = job.stats[(size_t)ch];
+                out << job.file.getFullPathName().quoted() << "," << ch << ","
+                    << juce::String(stats.peakDb, 2) << "," << juce::String(stats.maxRmsDb, 2) << ","
+                    << juce::String(getRmsDb(job, stats), 2) << "," << (stats.clipped ? "1" : "0") << ","
+                    << job.error.quoted() << "\n";
+            }
+            if (job.nChannels == 0) out << job.file.getFullPathName().quoted() << ",,,,,," << job.error.quoted() << "\n";
+            return out;
+        }
+
+        void writeResult(FileJob& job)
+        {
+            auto dir = options.outputDir == juce::File() ? job.file.getParentDirectory() : options.outputDir;
+            auto out = dir.getChildFile(job.file.getFileName() + (options.csv ? ".punch.csv" : ".punch.json"));
+
+            const juce::ScopedLock lock(job.statsLock);
+            bool ok = out.replaceWithText(options.csv ? toCsv(job) : toJson(job));
+            if (!ok || job.error.isNotEmpty()) failures++;
+
+            const juce::ScopedLock printLock(printMutex);
+            if (!ok) std::cerr << "Cannot write " << out.getFullPathName() << std::endl;
+            else if (job.error.isNotEmpty()) std::cerr << job.file.getFullPathName() << ": " << job.error << std::endl;
+            else std::cout << out.getFullPathName() << std::endl;
+        }
+
+        const Options& options;
+        juce::AudioFormatManager formatManager;
+        std::vector<std::unique_ptr<FileJob>> jobs;
+        juce::CriticalSection printMutex;
+        std::atomic<int> failures { 0 };
+    };
+
+    void printUsage()
+    {
+        std::cout << "Usage: PunchAnalyzer [--threads N] [--chunk-seconds S] [--csv] [--output DIR] files..." << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        juce::String arg(argv[i]);
+        bool hasValue = i + 1 < argc;
+        if (arg == "--threads" && hasValue) options.nThreads = juce::String(argv[++i]).getIntValue();
+        else if (arg == "--chunk-seconds" && hasValue) options.chunkSeconds = juce::jmax(rmsWindowSeconds, juce::String(argv[++i]).getDoubleValue());
+        else if (arg == "--output" && hasValue) options.outputDir = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+        else if (arg == "--csv") options.csv = true;
+        else if (arg == "--json") options.csv = false;
+        else if (arg == "--help" || arg.startsWith("--"))
+        {
+            printUsage();
+            return arg == "--help" ? 0 : 1;
+        }
+        else options.files.add(juce::File::getCurrentWorkingDirectory().getChildFile(arg));
+    }
+
+    if (options.files.isEmpty())
+    {
+        printUsage();
+        return 1;
+    }
+    if (options.outputDir != juce::File()) options.outputDir.createDirectory();
+
+    Analyzer analyzer(options);
+    return analyzer.run();
+}
@@ -0,0 +1,260 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+
+    Headless paint benchmark. Renders each punch component into an offscreen
+    software image over and over, fed with synthetic levels, and reports the
+    time and heap allocations per frame. Run it by hand before each release and
+    compare against the previous numbers to catch rendering regressions.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+//==============================================================================
+// Every heap allocation in the process goes through here while counting is on.
+namespace
+{
+    std::atomic<bool> countAllocations { false };
+    std::atomic<juce::int64> allocations { 0 };
+
+    void* allocate(std::size_t size)
+    {
+        if (countAllocations.load(std::memory_order_relaxed)) allocations.fetch_add(1, std::memory_order_relaxed);
+        if (auto* p = std::malloc(size == 0 ? 1 : size)) return p;
+        throw std::bad_alloc();
+    }
+}
+
+void* operator new(std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { try { return allocate(size); } catch (...) { return nullptr; } }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { try { return allocate(size); } catch (...) { return nullptr; } }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace
+{
+    struct Options
+    {
+        int frames = 2000;
+        int warmup = 50;
+        float scale = 1.0f;
+        int height = 400;
+        bool csv = false;
+        juce::String filter;
+    };
+
+    struct Result
+    {
+        juce::String name;
+        double meanMicros = 0.0;
+        double p99Micros = 0.0;
+        double allocsPerFrame = 0.0;
+    };
+
+    // Synthetic programme: a slow sweep from -60 dB to just over full scale with
+    // some noise on top, so lights, holds and the clip indicator all move.
+    class LevelSource
+    {
+    public:
+        LevelSource(int nChannels, int blockSize) : block(nChannels, blockSize) {}
+
+        juce::AudioBuffer<float>& next()
+        {
+            frame++;
+            float db = -60.0f + 31.0f * (1.0f + std::sin((float)frame * 0.02f));
+            float gain = juce::Decibels::decibelsToGain(db);
+            for (int c = 0; c < block.getNumChannels(); c++)
+            {
+                auto* d = block.getWritePointer(c);
+                for (int i = 0; i < block.getNumSamples(); i++) d[i] = gain * (random.nextFloat() * 2.0f - 1.0f);
+            }
+            return block;
+        }
+
+    private:
+        juce::AudioBuffer<float> block;
+        juce::Random random { 1234 };
+        int frame = 0;
+    };
+
+    class Benchmark
+    {
+    public:
+        Benchmark(const Options& o) : options(o) {}
+
+        int run()
+        {
+            using namespace punch;
+            const int h = options.height;
+
+            runMeter<SimpleBarLevelMeter>("SimpleBarLevelMeter", h);
+            runMeter<DrawnLEDLevelMeter>("DrawnLEDLevelMeter", h);
+            runMeter<UADLevelMeter>("UADLevelMeter", h);
+            runMeter<ContinuousBarLevelMeter>("ContinuousBarLevelMeter", h);
+
+            {
+                StereoLevelMeter stereo(-60.0f, 6.0f, 3.0f, 12, 12, 30.0f, 30.0f);
+                stereo.setBounds(0, 0, 120, h);
+                stereo.prepare(48000.0, 512);
+                LevelSource source(2, 512);
+                measure("StereoLevelMeter", stereo, [&]
+                    {
+                        stereo.capture(source.next());
+                        for (auto* c : stereo.getChildren())
+                            if (auto* meter = dynamic_cast<LevelMeter*>(c)) meter->takeSnapshot();
+                    });
+            }
+            {
+                dbAnnoComponent anno(-60.0f, 6.0f, 3.0f, 12, 12, 40.0f, juce::Justification::left, true);
+                anno.setBounds(0, 0, 40, h);
+                measure("dbAnnoComponent", anno, [] {});
+            }
+            {
+                FaderSlider fader;
+                fader.setSliderStyle(juce::Slider::LinearVertical);
+                fader.setRange(0.0, 1.0);
+                fader.setBounds(0, 0, 60, h);
+                int frame = 0;
+                measure("FaderSlider", fader, [&] { fader.setValue(0.5 + 0.5 * std::sin(++frame * 0.013), juce::dontSendNotification); });
+            }
+
+            print();
+            return 0;
+        }
+
+    private:
+        template <typename Meter>
+        void runMeter(const juce::String& name, int height)
+        {
+            Meter meter(12, 12, -60.0f, 6.0f, 3.0f);
+            meter.setBounds(0, 0, 40, height);
+            meter.prepare(48000.0, 512);
+            LevelSource source(1, 512);
+            measure(name, meter, [&]
+                {
+                    meter.capture(source.next(), 0);
+                    meter.takeSnapshot();
+                });
+        }
+
+        // feed() runs outside the timed and counted region, only the paint is measured.
+        template <typename Feed>
+        void measure(const juce::String& name, juce::Component& component, Feed&& feed)
+        {
+            if (options.filter.isNotEmpty() && !name.containsIgnoreCase(options.filter)) return;
+
+            juce::Image image(juce::Image::ARGB,
+                juce::jmax(1, juce::roundToInt((float)component.getWidth() * options.scale)),
+                juce::jmax(1, juce::roundToInt((float)component.getHeight() * options.scale)),
+                true, juce::SoftwareImageType());
+            juce::Graphics g(image);
+            g.addTransform(juce::AffineTransform::scale(options.scale));
+
+            std::vector<double> micros;
+            micros.reserve((size_t)options.frames);
+            juce::int64 allocated = 0;
+
+            for (int f = 0; f < options.warmup + options.frames; f++)
+            {
+                feed();
+
+                bool measured = f >= options.warmup;
+                allocations = 0;
+                countAllocations = measured;
+                auto start = juce::Time::getHighResolutionTicks();
+
+                g.fillAll(juce::Colours::black);
+                component.paintEntireComponent(g, false);
+
+                auto end = juce::Time::getHighResolutionTicks();
+                countAllocations = false;
+
+                if (measured)
+                {
+                    micros.push_back(juce::Time::highResolutionTicksToSeconds(end - start) * 1.0e6);
+                    allocated += allocations.load();
+                }
+            }
+
+            Result r;
+            r.name = name;
+            if (!micros.empty())
+            {
+                double total = 0.0;
+                for (auto m : micros) total += m;
+                r.meanMicros = total / (double)micros.size();
+                std::sort(micros.begin(), micros.end());
+                r.p99Micros = micros[juce::jmin(micros.size() - 1, (size_t)((double)micros.size() * 0.99))];
+                r.allocsPerFrame = (double)allocated / (double)micros.size();
+            }
+            results.add(r);
+        }
+
+        void print()
+        {
+            if (options.csv)
+            {
+                std::cout << "component,scale,height,mean_us,p99_us,allocs_per_frame" << std::endl;
+                for (auto& r : results)
+                    std::cout << r.name << "," << options.scale << "," << options.height << ","
+                              << juce::String(r.meanMicros, 2) << "," << juce::String(r.p99Micros, 2) << ","
+                              << juce::String(r.allocsPerFrame, 2) << std::endl;
+                return;
+            }
+
+            std::cout << "scale " << options.scale << ", height " << options.height << ", "
+                      << options.frames << " frames" << std::endl;
+            std::cout << juce::String("component").paddedRight(' ', 26) << juce::String("mean us").paddedLeft(' ', 10)
+                      << juce::String("p99 us").paddedLeft(' ', 10) << juce::String("allocs").paddedLeft(' ', 10) << std::endl;
+            for (auto& r : results)
+                std::cout << r.name.paddedRight(' ', 26) << juce::String(r.meanMicros, 2).paddedLeft(' ', 10)
+                          << juce::String(r.p99Micros, 2).paddedLeft(' ', 10)
+                          << juce::String(r.allocsPerFrame, 2).paddedLeft(' ', 10) << std::endl;
+        }
+
+        const Options& options;
+        juce::Array<Result> results;
+    };
+
+    void printUsage()
+    {
+        std::cout << "Usage: PunchBenchmark [--frames N] [--warmup N] [--scale S] [--height H] [--filter NAME] [--csv]" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        juce::String arg(argv[i]);
+        bool hasValue = i + 1 < argc;
+        if (arg == "--frames" && hasValue) options.frames = juce::jmax(1, juce::String(argv[++i]).getIntValue());
+        else if (arg == "--warmup" && hasValue) options.warmup = juce::jmax(0, juce::String(argv[++i]).getIntValue());
+        else if (arg == "--scale" && hasValue) options.scale = juce::jlimit(0.5f, 4.0f, juce::String(argv[++i]).getFloatValue());
+        else if (arg == "--height" && hasValue) options.height = juce::jmax(100, juce::String(argv[++i]).getIntValue());
+        else if (arg == "--filter" && hasValue) options.filter = argv[++i];
+        else if (arg == "--csv") options.csv = true;
+        else
+        {
+            printUsage();
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    // Components need a message manager, but nothing here opens a window.
+    juce::ScopedJuceInitialiser_GUI gui;
+    Benchmark benchmark(options);
+    return benchmark.run();
+}
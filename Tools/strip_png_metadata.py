@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+"""
+Strips metadata from the PNGs embedded in the punch sources.
+
+The image arrays in Fader/FaderSlider.cpp and Meter/StereoLevelMeter.cpp are
+Projucer BinaryData literals. Exported PNGs carry XMP packets, colour profiles
+and text chunks that are larger than the pixels. This script decodes each
+literal and drops every ancillary chunk except tRNS, which is part of the
+pixels. It also recompresses the image data when that is smaller, then
+writes the literal back and updates its size in the source and header.
+
+    python3 Tools/strip_png_metadata.py           rewrite the sources in place
+    python3 Tools/strip_png_metadata.py --check   exit 1 if anything would change
+
+Run it after adding or replacing an embedded image.
+"""
+
+import os
+import re
+import struct
+import sys
+import zlib
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+# (source holding the literal, header holding the size constant, resource name)
+ASSETS = [
+    ("Fader/FaderSlider.cpp", "Fader/FaderSlider.h", "faderalphanonflat_png"),
+    ("Meter/StereoLevelMeter.cpp", "Meter/StereoLevelMeter.h", "APILights_png"),
+]
+
+# Only the chunks that define the pixels are kept. Colour space chunks (gAMA, cHRM,
+# sRGB, iCCP) and sBIT go too, juce::PNGImageFormat does no colour management.
+KEEP = {b"IHDR", b"PLTE", b"IDAT", b"IEND", b"tRNS"}
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+MAX_CHARS_ON_LINE = 250
+
+
+def decode_literal(text):
+    """Turns a run of adjacent C string literals into bytes."""
+    out = bytearray()
+    for piece in re.findall(r'"((?:[^"\\]|\\.)*)"', text, re.S):
+        i = 0
+        while i < len(piece):
+            c = piece[i]
+            if c != "\\":
+                out.append(ord(c))
+                i += 1
+                continue
+            e = piece[i + 1]
+            if e == "x":
+                j = i + 2
+                while j < len(piece) and piece[j] in "0123456789abcdefABCDEF":
+                    j += 1
+                out.append(int(piece[i + 2:j], 16) & 0xff)
+                i = j
+            elif e in "01234567":
+                j = i + 1
+                while j < len(piece) and j < i + 4 and piece[j] in "01234567":
+                    j += 1
+                out.append(int(piece[i + 1:j], 8))
+                i = j
+            else:
+                out.append(ord({"n": "\n", "r": "\r", "t": "\t", "a": "\a", "b": "\b",
+                                "f": "\f", "v": "\v"}.get(e, e)))
+                i += 2
+    return bytes(out)
+
+
+def encode_literal(data, indent):
+    """Writes bytes the way the Projucer BinaryData generator does."""
+    lines = []
+    line = ""
+    last_was_escape = False
+    for n, c in enumerate(data):
+        new_line = False
+        if c == 0x09:
+            line += "\\t"
+            last_was_escape = False
+        elif c == 0x0d:
+            line += "\\r"
+            last_was_escape = False
+        elif c == 0x0a:
+            line += "\\n"
+            last_was_escape = False
+            new_line = True
+        elif c == 0x5c:
+            line += "\\\\"
+            last_was_escape = False
+        elif c == 0x22:
+            line += "\\\""
+            last_was_escape = False
+        elif c == 0:
+            line += "\\0"
+            last_was_escape = True
+        elif 32 <= c < 127:
+            is_hex = chr(c) in "0123456789abcdefABCDEF"
+            if last_was_escape and is_hex:
+                line += '""'
+            line += chr(c)
+            last_was_escape = False
+        else:
+            line += "\\x%02x" % c
+            last_was_escape = True
+
+        if (new_line or len(line) >= MAX_CHARS_ON_LINE) and n < len(data) - 1:
+            lines.append(line)
+            line = ""
+            last_was_escape = False
+    lines.append(line)
+    return "\n".join(indent + '"' + l + '"' for l in lines)
+
+
+def chunks(png):
+    if not png.startswith(PNG_SIGNATURE):
+        raise ValueError("not a PNG")
+    pos = len(PNG_SIGNATURE)
+    while pos < len(png):
+        length, kind = struct.unpack(">I4s", png[pos:pos + 8])
+        yield kind, png[pos + 8:pos + 8 + length]
+        pos += 12 + length
+
+
+def chunk(kind, body):
+    return struct.pack(">I", len(body)) + kind + body + struct.pack(">I", zlib.crc32(kind + body) & 0xffffffff)
+
+
+def strip(png):
+    kept = [(k, b) for k, b in chunks(png) if k in KEEP]
+
+    # Recompress the image data as one IDAT when that saves anything.
+    idat = b"".join(b for k, b in kept if k == b"IDAT")
+    packed = zlib.compress(zlib.decompress(idat), 9)
+    if len(packed) >= len(idat):
+        packed = None
+
+    out = bytearray(PNG_SIGNATURE)
+    wrote_idat = False
+    for k, b in kept:
+        if k == b"IDAT" and packed is not None:
+            if not wrote_idat:
+                out += chunk(k, packed)
+                wrote_idat = True
+            continue
+        out += chunk(k, b)
+    return bytes(out)
+
+
+def resource_hash(name):
+    h = 0
+    for c in name.encode("utf-8"):
+        h = (31 * h + c) & 0xffffffff
+    return h
+
+
+def process(source, header, name, check):
+    source_path = os.path.join(ROOT, source)
+    header_path = os.path.join(ROOT, header)
+    with open(source_path, newline="") as f:
+        text = f.read()
+
+    var = re.search(r"const char\*\s+%s\s*=\s*\(const char\*\)(\w+);" % re.escape(name), text).group(1)
+    literal = re.search(r"(static const unsigned char %s\[\] =\n)((?:[ \t]*\".*\"\n?)+?);" % re.escape(var), text, re.M)
+    indent = re.match(r"[ \t]*", literal.group(2)).group(0)
+
+    png = decode_literal(literal.group(2))
+    stripped = strip(png)
+    print("%s: %d -> %d bytes" % (name, len(png), len(stripped)))
+    if stripped == png:
+        return False
+    if check:
+        return True
+
+    text = text[:literal.start(2)] + encode_literal(stripped, indent) + text[literal.end(2):]
+    text = re.sub(r"(case 0x%08x:\s*numBytes = )\d+" % resource_hash(name), r"\g<1>%d" % len(stripped), text)
+    with open(source_path, "w", newline="") as f:
+        f.write(text)
+
+    with open(header_path, newline="") as f:
+        htext = f.read()
+    htext = re.sub(r"(const int\s+%sSize = )\d+;" % re.escape(name), r"\g<1>%d;" % len(stripped), htext)
+    with open(header_path, "w", newline="") as f:
+        f.write(htext)
+    return True
+
+
+def main():
+    check = "--check" in sys.argv[1:]
+    changed = [process(s, h, n, check) for s, h, n in ASSETS]
+    if check and any(changed):
+        print("Embedded images carry metadata, run Tools/strip_png_metadata.py")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -11,19 +11,9 @@
 // #include "TwoValueAttachment.h"
 namespace punch
 {
-    TwoValueSliderParameterAttachment::TwoValueSliderParameterAttachment(juce::RangedAudioParameter* param,
-        ValueType v,
-        juce::Slider& s,
-        juce::UndoManager* um)
-        : slider(s),
-        valueType(v),
-        attachment(*param, [this](float f) { setValue(f); }, um)
+    juce::NormalisableRange<double> makeSliderRange(const juce::RangedAudioParameter& param)
     {
-        slider.valueFromTextFunction = [param](const juce::String& text) { return (double)param->convertFrom0to1(param->getValueForText(text)); };
-        slider.textFromValueFunction = [param](double value) { return param->getText(param->convertTo0to1((float)value), 0); };
-        slider.setDoubleClickReturnValue(true, param->convertFrom0to1(param->getDefaultValue()));
-
-        auto range = param->getNormalisableRange();
+        auto range = param.getNormalisableRange();
 
         auto convertFrom0To1Function = [range](double currentRangeStart,
             double currentRangeEnd,
@@ -61,7 +51,22 @@ namespace punch
         newRange.skew = range.skew;
         newRange.symmetricSkew = range.symmetricSkew;
 
-        slider.setNormalisableRange(newRange);
+        return newRange;
+    }
+
+    TwoValueSliderParameterAttachment::TwoValueSliderParameterAttachment(juce::RangedAudioParameter* param,
+        ValueType v,
+        juce::Slider& s,
+        juce::UndoManager* um)
+        : slider(s),
+        valueType(v),
+        attachment(*param, [this](float f) { setValue(f); }, um)
+    {
+        slider.valueFromTextFunction = [param](const juce::String& text) { return (double)param->convertFrom0to1(param->getValueForText(text)); };
+        slider.textFromValueFunction = [param](double value) { return param->getText(param->convertTo0to1((float)value), 0); };
+        slider.setDoubleClickReturnValue(true, param->convertFrom0to1(param->getDefaultValue()));
+
+        slider.setNormalisableRange(makeSliderRange(*param));
 
         sendInitialUpdate();
         slider.valueChanged();
@@ -70,15 +75,59 @@ namespace punch
 
     TwoValueSliderParameterAttachment::~TwoValueSliderParameterAttachment()
     {
+        if (partner != nullptr) partner->partner = nullptr;
         slider.removeListener(this);
     }
 
-    void TwoValueSliderParameterAttachment::sendInitialUpdate() { attachment.sendInitialUpdate(); }
+    void TwoValueSliderParameterAttachment::sendInitialUpdate()
+    {
+        attachment.sendInitialUpdate();
+        applyPending(); // the slider should be right before the first frame
+    }
+
+    void TwoValueSliderParameterAttachment::pairWith(TwoValueSliderParameterAttachment& other)
+    {
+        jassert(&other.slider == &slider && other.valueType != valueType);
+        partner = &other;
+        other.partner = this;
+    }
 
     void TwoValueSliderParameterAttachment::setValue(float newValue)
     {
-        const juce::ScopedValueSetter<bool> svs(ignoreCallbacks, true);
-        valueType == ValueType::MinValue ? slider.setMinValue(newValue, juce::sendNotificationSync) : slider.setMaxValue(newValue, juce::sendNotificationSync);
+        // Host changes are only recorded here, refresh() applies the latest one per frame.
+        pendingValue = newValue;
+        hasPending = true;
+    }
+
+    void TwoValueSliderParameterAttachment::refresh()
+    {
+        // A pair is applied by its min attachment only.
+        if (partner != nullptr && valueType == ValueType::MaxValue) return;
+        if (hasPending || (partner != nullptr && partner->hasPending)) applyPending();
+    }
+
+    void TwoValueSliderParameterAttachment::applyPending()
+    {
+        if (partner == nullptr)
+        {
+            if (!hasPending) return;
+            hasPending = false;
+            const juce::ScopedValueSetter<bool> svs(ignoreCallbacks, true);
+            valueType == ValueType::MinValue ? slider.setMinValue(pendingValue, juce::sendNotificationSync) : slider.setMaxValue(pendingValue, juce::sendNotificationSync);
+            return;
+        }
+
+        auto& minSide = valueType == ValueType::MinValue ? *this : *partner;
+        auto& maxSide = valueType == ValueType::MinValue ? *partner : *this;
+        double newMin = minSide.hasPending ? (double)minSide.pendingValue : slider.getMinValue();
+        double newMax = maxSide.hasPending ? (double)maxSide.pendingValue : slider.getMaxValue();
+        minSide.hasPending = false;
+        maxSide.hasPending = false;
+
+        const juce::ScopedValueSetter<bool> svsMin(minSide.ignoreCallbacks, true);
+        const juce::ScopedValueSetter<bool> svsMax(maxSide.ignoreCallbacks, true);
+        // Like setMinValue, a min above the max is clamped to it and the max stays put.
+        slider.setMinAndMaxValues(juce::jmin(newMin, newMax), newMax, juce::sendNotificationSync);
     }
 
     void TwoValueSliderParameterAttachment::sliderValueChanged(juce::Slider*)
@@ -100,5 +149,6 @@ namespace punch
             slider,
             stateToUse.undoManager))
     {
+        attachment1->pairWith(*attachment2);
     }
 }
\ No newline at end of file
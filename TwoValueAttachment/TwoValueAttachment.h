@@ -12,7 +12,11 @@
 
 namespace punch
 {
-    class TwoValueSliderParameterAttachment : private juce::Slider::Listener
+    /** The parameter's range as a slider range, keeping its skew and interval. */
+    juce::NormalisableRange<double> makeSliderRange(const juce::RangedAudioParameter& param);
+
+    class TwoValueSliderParameterAttachment : private juce::Slider::Listener,
+        private RefreshScheduler::Client
     {
     public:
         enum ValueType {
@@ -38,8 +42,15 @@ namespace punch
         */
         void sendInitialUpdate();
 
+        /** Applies both attachments of a range slider together, so a frame where
+            both parameters moved costs one slider update and one repaint.
+        */
+        void pairWith(TwoValueSliderParameterAttachment& other);
+
     private:
         void setValue(float newValue);
+        void applyPending();
+        void refresh() override;
         void sliderValueChanged(juce::Slider*) override;
 
         void sliderDragStarted(juce::Slider*) override { attachment.beginGesture(); }
@@ -47,6 +58,9 @@ namespace punch
         ValueType valueType;
         juce::Slider& slider;
         juce::ParameterAttachment attachment;
+        TwoValueSliderParameterAttachment* partner = nullptr;
+        float pendingValue = 0.0f;
+        bool hasPending = false;
         bool ignoreCallbacks = false;
     };
 
@@ -33,9 +33,18 @@
 #endif
 
 #include "punch.h"
+#include "./Scheduler/RefreshScheduler.cpp"
+#include "./Scheduler/RenderPool.cpp"
 #include "./TwoValueAttachment/TwoValueAttachment.cpp"
+#include "./Attachment/ParameterAttachmentManager.cpp"
 #include "./Slider/SmoothSlider.cpp"
 #include "./Fader/FaderSlider.cpp"
+#include "./Fader/FaderGain.cpp"
+#include "./Annotation/DbPixelMap.cpp"
 #include "./Annotation/dbAnnoComponent.cpp"
+#include "./Meter/ClipEventLog.cpp"
 #include "./Meter/MaximumAmp.cpp"
-#include "./Meter/StereoLevelMeter.cpp"
\ No newline at end of file
+#include "./Meter/AnalysisThread.cpp"
+#include "./Meter/StereoLevelMeter.cpp"
+#include "./Scope/Oscilloscope.cpp"
+#include "./Strip/ChannelStrip.cpp"
\ No newline at end of file
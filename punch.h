@@ -55,9 +55,18 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_core/juce_core.h>
 #include <juce_audio_basics/juce_audio_basics.h>
+#include "./Scheduler/RefreshScheduler.h"
+#include "./Scheduler/RenderPool.h"
 #include "./TwoValueAttachment/TwoValueAttachment.h"
+#include "./Attachment/ParameterAttachmentManager.h"
 #include "./Slider/SmoothSlider.h"
 #include "./Fader/FaderSlider.h"
+#include "./Fader/FaderGain.h"
+#include "./Annotation/DbPixelMap.h"
 #include "./Annotation/dbAnnoComponent.h"
+#include "./Meter/ClipEventLog.h"
 #include "./Meter/MaximumAmp.h"
+#include "./Meter/AnalysisThread.h"
 #include "./Meter/StereoLevelMeter.h"
+#include "./Scope/Oscilloscope.h"
+#include "./Strip/ChannelStrip.h"